@@ -6,6 +6,17 @@ get_filename_component(CoreBenchmarksDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 
 set(CoreBenchmarksSources
     ${CoreBenchmarksDir}/Main.cpp
+    ${CoreBenchmarksDir}/benchmarks_Vector.cpp
+    ${CoreBenchmarksDir}/benchmarks_SortedVector.cpp
+    ${CoreBenchmarksDir}/benchmarks_SortedFlatMap.cpp
+    ${CoreBenchmarksDir}/benchmarks_SoAVector.cpp
+    ${CoreBenchmarksDir}/benchmarks_String.cpp
+    ${CoreBenchmarksDir}/benchmarks_Hash.cpp
+    ${CoreBenchmarksDir}/benchmarks_FlatHashMap.cpp
+    ${CoreBenchmarksDir}/benchmarks_Functor.cpp
+    ${CoreBenchmarksDir}/benchmarks_Queue.cpp
+    ${CoreBenchmarksDir}/benchmarks_Scheduler.cpp
+    ${CoreBenchmarksDir}/benchmarks_Allocator.cpp
 )
 
 add_executable(${PROJECT_NAME} ${CoreBenchmarksSources})
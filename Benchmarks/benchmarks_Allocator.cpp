@@ -0,0 +1,100 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the pool resource against the pmr pools
+ */
+
+#include <array>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/AlignedHeapArray.hpp>
+#include <Core/PoolResource.hpp>
+#include <Core/UniqueAlloc.hpp>
+
+namespace
+{
+    /** @brief Object typically allocated through UniqueAlloc (an audio node) */
+    struct Node
+    {
+        std::array<float, 16> data {};
+    };
+}
+
+template<typename Allocator>
+static void Allocator_Single(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto node = Core::UniqueAlloc<Node, Allocator>::Make();
+        benchmark::DoNotOptimize(node.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Allocator>
+static void Allocator_Batch(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<Core::UniqueAlloc<Node, Allocator>> nodes(count);
+
+    for (auto _ : state) {
+        for (auto &node : nodes)
+            node = Core::UniqueAlloc<Node, Allocator>::Make();
+        benchmark::DoNotOptimize(nodes.data());
+        for (auto &node : nodes)
+            node.release();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+/** @brief Each thread allocates and releases its own batch concurrently */
+template<typename Allocator>
+static void Allocator_Threaded(benchmark::State &state)
+{
+    using Alloc = Core::UniqueAlloc<Node, Allocator>;
+    constexpr auto BatchSize = 256ul;
+    static std::vector<Alloc> Batches[64];
+
+    auto &batch = Batches[static_cast<std::size_t>(state.thread_index())];
+    for (auto _ : state) {
+        batch.resize(BatchSize);
+        for (auto &node : batch)
+            node = Alloc::Make();
+        benchmark::DoNotOptimize(batch.data());
+        batch.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BatchSize));
+}
+
+BENCHMARK_TEMPLATE(Allocator_Single, std::pmr::unsynchronized_pool_resource);
+BENCHMARK_TEMPLATE(Allocator_Single, std::pmr::synchronized_pool_resource);
+BENCHMARK_TEMPLATE(Allocator_Single, Core::PoolResource);
+
+BENCHMARK_TEMPLATE(Allocator_Batch, std::pmr::unsynchronized_pool_resource)->Range(64, 4096);
+BENCHMARK_TEMPLATE(Allocator_Batch, std::pmr::synchronized_pool_resource)->Range(64, 4096);
+BENCHMARK_TEMPLATE(Allocator_Batch, Core::PoolResource)->Range(64, 4096);
+
+BENCHMARK_TEMPLATE(Allocator_Threaded, std::pmr::synchronized_pool_resource)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(Allocator_Threaded, Core::PoolResource)->ThreadRange(1, 8)->UseRealTime();
+
+/** @brief Allocate a sample buffer then write every sample, as a sample loader does */
+template<bool Initialize>
+static void Allocator_AudioBuffer(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Core::AudioBuffer<float> buffer;
+        if constexpr (Initialize)
+            buffer.allocate(count);
+        else
+            buffer.allocateUninitialized(count);
+        for (auto i = 0ul; i < count; ++i)
+            buffer[i] = static_cast<float>(i);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count * sizeof(float)));
+}
+
+BENCHMARK_TEMPLATE(Allocator_AudioBuffer, true)->Range(1 << 12, 1 << 22);
+BENCHMARK_TEMPLATE(Allocator_AudioBuffer, false)->Range(1 << 12, 1 << 22);
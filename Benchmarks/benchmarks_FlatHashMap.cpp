@@ -0,0 +1,115 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the flat hash map against std::unordered_map
+ */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/FlatHashMap.hpp>
+#include <Core/String.hpp>
+
+namespace
+{
+    /** @brief Identifier-like keys */
+    [[nodiscard]] std::vector<std::string> MakeNames(const std::size_t count)
+    {
+        std::vector<std::string> names;
+
+        names.reserve(count);
+        for (auto i = 0ul; i < count; ++i)
+            names.emplace_back("Oscillator/Voice" + std::to_string(i) + "/Cutoff");
+        return names;
+    }
+
+    template<typename Key, typename InsertKey>
+    inline void Emplace(std::unordered_map<Key, std::size_t> &map, InsertKey &&key, const std::size_t value)
+    {
+        map.try_emplace(std::forward<InsertKey>(key), value);
+    }
+
+    template<typename Key, typename InsertKey>
+    inline void Emplace(Core::FlatHashMap<Key, std::size_t> &map, InsertKey &&key, const std::size_t value)
+    {
+        map.tryEmplace(std::forward<InsertKey>(key), value);
+    }
+}
+
+template<typename Map>
+static void FlatHashMap_InsertInteger(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Map map;
+        for (auto i = 0ul; i < count; ++i)
+            Emplace(map, i * 0x9E3779B97F4A7C15ull, i);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template<typename Map>
+static void FlatHashMap_FindInteger(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    Map map;
+
+    for (auto i = 0ul; i < count; ++i)
+        Emplace(map, i * 0x9E3779B97F4A7C15ull, i);
+    for (auto _ : state) {
+        std::size_t sum = 0ul;
+        // Half of the lookups miss
+        for (auto i = 0ul; i < count * 2ul; ++i)
+            sum += map.find(i * 0x9E3779B97F4A7C15ull) != map.end();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count * 2ul));
+}
+
+template<typename Map, typename Key>
+static void FlatHashMap_FindString(benchmark::State &state)
+{
+    const auto names = MakeNames(static_cast<std::size_t>(state.range(0)));
+    Map map;
+
+    for (auto i = 0ul; i < names.size(); ++i)
+        Emplace(map, Key(std::string_view(names[i])), i);
+    for (auto _ : state) {
+        std::size_t sum = 0ul;
+        for (const auto &name : names)
+            sum += map.find(Key(std::string_view(name)))->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * names.size()));
+}
+
+/** @brief String lookups without building a key */
+static void FlatHashMap_FindStringView(benchmark::State &state)
+{
+    const auto names = MakeNames(static_cast<std::size_t>(state.range(0)));
+    Core::FlatHashMap<Core::String, std::size_t> map;
+
+    for (auto i = 0ul; i < names.size(); ++i)
+        map.tryEmplace(std::string_view(names[i]), i);
+    for (auto _ : state) {
+        std::size_t sum = 0ul;
+        for (const auto &name : names)
+            sum += map.find(std::string_view(name))->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * names.size()));
+}
+
+#define REGISTER_HASH_MAP_BENCHMARK(Function, Key) \
+    BENCHMARK_TEMPLATE(Function, std::unordered_map<Key, std::size_t>)->Arg(64)->Arg(4096)->Arg(1 << 18); \
+    BENCHMARK_TEMPLATE(Function, Core::FlatHashMap<Key, std::size_t>)->Arg(64)->Arg(4096)->Arg(1 << 18);
+
+REGISTER_HASH_MAP_BENCHMARK(FlatHashMap_InsertInteger, std::size_t)
+REGISTER_HASH_MAP_BENCHMARK(FlatHashMap_FindInteger, std::size_t)
+BENCHMARK_TEMPLATE(FlatHashMap_FindString, std::unordered_map<std::string, std::size_t>, std::string)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(FlatHashMap_FindString, Core::FlatHashMap<Core::String, std::size_t>, Core::String)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK(FlatHashMap_FindStringView)->Arg(64)->Arg(4096)->Arg(1 << 16);
@@ -0,0 +1,108 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the functors and dispatchers against std::function
+ */
+
+#include <functional>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/Functor.hpp>
+#include <Core/TrivialFunctor.hpp>
+#include <Core/Dispatcher.hpp>
+
+namespace
+{
+    /** @brief Free function used as invocation target */
+    [[gnu::noinline]] int FreeFunction(const int x) { return x * 2; }
+
+    /** @brief Vector of std::function used as dispatcher baseline */
+    struct StdDispatcher
+    {
+        std::vector<std::function<void(int)>> functors;
+
+        template<typename Functor>
+        void add(Functor &&functor) { functors.emplace_back(std::forward<Functor>(functor)); }
+
+        void dispatch(const int x)
+        {
+            for (auto &functor : functors)
+                functor(x);
+        }
+    };
+}
+
+template<typename FunctorType>
+static void Functor_InvokeLambda(benchmark::State &state)
+{
+    int offset = 42;
+    FunctorType functor([offset](const int x) { return x + offset; });
+    int x = 0;
+
+    for (auto _ : state) {
+        x = functor(x);
+        benchmark::DoNotOptimize(x);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename FunctorType>
+static void Functor_InvokeFree(benchmark::State &state)
+{
+    FunctorType functor;
+    if constexpr (std::is_same_v<FunctorType, std::function<int(int)>>)
+        functor = &FreeFunction;
+    else
+        functor.template prepare<&FreeFunction>();
+    int x = 0;
+
+    for (auto _ : state) {
+        x = functor(x);
+        benchmark::DoNotOptimize(x);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename FunctorType>
+static void Functor_Construct(benchmark::State &state)
+{
+    int offset = 42;
+
+    for (auto _ : state) {
+        FunctorType functor([offset](const int x) { return x + offset; });
+        benchmark::DoNotOptimize(&functor);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename DispatcherType>
+static void Dispatcher_Dispatch(benchmark::State &state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    int sum = 0;
+    DispatcherType dispatcher;
+
+    for (auto i = 0; i < count; ++i)
+        dispatcher.add([&sum, i](const int x) { sum += x + i; });
+    for (auto _ : state) {
+        dispatcher.dispatch(1);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(Functor_InvokeLambda, std::function<int(int)>);
+BENCHMARK_TEMPLATE(Functor_InvokeLambda, Core::Functor<int(int)>);
+BENCHMARK_TEMPLATE(Functor_InvokeLambda, Core::TrivialFunctor<int(int)>);
+
+BENCHMARK_TEMPLATE(Functor_InvokeFree, std::function<int(int)>);
+BENCHMARK_TEMPLATE(Functor_InvokeFree, Core::Functor<int(int)>);
+BENCHMARK_TEMPLATE(Functor_InvokeFree, Core::TrivialFunctor<int(int)>);
+
+BENCHMARK_TEMPLATE(Functor_Construct, std::function<int(int)>);
+BENCHMARK_TEMPLATE(Functor_Construct, Core::Functor<int(int)>);
+BENCHMARK_TEMPLATE(Functor_Construct, Core::TrivialFunctor<int(int)>);
+
+BENCHMARK_TEMPLATE(Dispatcher_Dispatch, StdDispatcher)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK_TEMPLATE(Dispatcher_Dispatch, Core::Dispatcher<void(int)>)->RangeMultiplier(4)->Range(1, 256);
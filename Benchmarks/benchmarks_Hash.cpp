@@ -0,0 +1,68 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the hash function against the previous implementation and std::hash
+ */
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/Hash.hpp>
+
+namespace
+{
+    /** @brief Previous 32 bits implementation, reading one byte per step */
+    [[nodiscard]] constexpr std::uint32_t LegacyHash(const char * const str, const std::size_t len) noexcept
+    {
+        std::uint32_t hash = 4294967291u;
+
+        for (auto i = 0ul; i < len; ++i)
+            hash = (hash * 31u) + static_cast<std::uint32_t>(str[i]);
+        return hash;
+    }
+
+    struct LegacyHasher
+    {
+        [[nodiscard]] std::size_t operator()(const std::string_view &str) const noexcept { return LegacyHash(str.data(), str.size()); }
+    };
+
+    struct CoreHasher
+    {
+        [[nodiscard]] std::size_t operator()(const std::string_view &str) const noexcept { return Core::Hash(str); }
+    };
+
+    /** @brief Build an input of the given size out of identifier-like text */
+    [[nodiscard]] std::string MakeInput(const std::size_t size)
+    {
+        constexpr std::string_view Pattern = "Oscillator/Voice/Filter/Cutoff/Frequency/Modulation/";
+        std::string str;
+
+        str.reserve(size);
+        while (str.size() < size)
+            str.push_back(Pattern[str.size() % Pattern.size()]);
+        return str;
+    }
+}
+
+template<typename Hasher>
+static void Hash_Throughput(benchmark::State &state)
+{
+    const auto input = MakeInput(static_cast<std::size_t>(state.range(0)));
+    const Hasher hasher {};
+
+    for (auto _ : state) {
+        auto view = std::string_view(input);
+        benchmark::DoNotOptimize(view);
+        benchmark::DoNotOptimize(hasher(view));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+#define REGISTER_HASH_BENCHMARK(Hasher) \
+    BENCHMARK_TEMPLATE(Hash_Throughput, Hasher)->Arg(4)->Arg(16)->Arg(32)->Arg(128)->Arg(1024)->Arg(1 << 16);
+
+REGISTER_HASH_BENCHMARK(LegacyHasher)
+REGISTER_HASH_BENCHMARK(CoreHasher)
+REGISTER_HASH_BENCHMARK(std::hash<std::string_view>)
@@ -0,0 +1,335 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the lock-free queues against a mutex protected queue
+ */
+
+#include <array>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/SPSCQueue.hpp>
+#include <Core/MPMCQueue.hpp>
+#include <Core/MPSCQueue.hpp>
+#include <Core/SPSCUnboundedQueue.hpp>
+#include <Core/BroadcastRing.hpp>
+
+namespace
+{
+    constexpr std::size_t QueueCapacity = 4096;
+
+    /** @brief Bounded std::deque protected by a std::mutex, used as baseline */
+    template<typename Type>
+    class MutexQueue
+    {
+    public:
+        MutexQueue(const std::size_t capacity) : _capacity(capacity) {}
+
+        template<typename ...Args>
+        [[nodiscard]] bool push(Args &&...args)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_queue.size() == _capacity)
+                return false;
+            _queue.emplace_back(std::forward<Args>(args)...);
+            return true;
+        }
+
+        [[nodiscard]] bool pop(Type &value)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_queue.empty())
+                return false;
+            value = std::move(_queue.front());
+            _queue.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex _mutex {};
+        std::deque<Type> _queue {};
+        std::size_t _capacity {};
+    };
+
+    /** @brief Shared queue instance of a multithreaded benchmark (created before threads are started) */
+    template<typename Queue>
+    std::unique_ptr<Queue> SharedQueue {};
+}
+
+template<typename Queue>
+static void Queue_PushPop(benchmark::State &state)
+{
+    Queue queue(QueueCapacity);
+    std::size_t value = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queue.push(value));
+        benchmark::DoNotOptimize(queue.pop(value));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Queue>
+static void Queue_Burst(benchmark::State &state)
+{
+    const auto burst = static_cast<std::size_t>(state.range(0));
+    Queue queue(QueueCapacity);
+    std::size_t value = 0;
+
+    for (auto _ : state) {
+        for (auto i = 0ul; i < burst; ++i)
+            benchmark::DoNotOptimize(queue.push(i));
+        for (auto i = 0ul; i < burst; ++i)
+            benchmark::DoNotOptimize(queue.pop(value));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(burst));
+}
+
+template<typename Queue>
+static void Queue_BurstRange(benchmark::State &state)
+{
+    const auto burst = static_cast<std::size_t>(state.range(0));
+    Queue queue(QueueCapacity);
+    std::vector<std::size_t> values(burst);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queue.pushRange(values.begin(), values.end()));
+        benchmark::DoNotOptimize(queue.popRange(values.begin(), values.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(burst));
+}
+
+/** @brief Produce a block of samples and transfer it through the queue, copying it in and out */
+static void Queue_BlockCopy(benchmark::State &state)
+{
+    const auto blockSize = static_cast<std::size_t>(state.range(0));
+    Core::SPSCQueue<float> queue(blockSize * 4);
+    std::vector<float> input(blockSize), output(blockSize);
+    auto sample = 0.0f;
+
+    for (auto _ : state) {
+        std::fill(input.begin(), input.end(), ++sample);
+        benchmark::DoNotOptimize(queue.pushRange(input.begin(), input.end()));
+        benchmark::DoNotOptimize(queue.popRange(output.begin(), output.end()));
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(blockSize * sizeof(float)));
+}
+
+/** @brief Produce a block of samples directly into the queue and consume it in place */
+static void Queue_BlockInPlace(benchmark::State &state)
+{
+    const auto blockSize = static_cast<std::size_t>(state.range(0));
+    Core::SPSCQueue<float> queue(blockSize * 4);
+    auto sample = 0.0f;
+
+    for (auto _ : state) {
+        const auto write = queue.beginWrite(blockSize);
+        ++sample;
+        std::fill(write.first.begin(), write.first.end(), sample);
+        std::fill(write.second.begin(), write.second.end(), sample);
+        queue.commitWrite(write.size());
+        const auto read = queue.beginRead(blockSize);
+        benchmark::DoNotOptimize(read.first.data());
+        benchmark::DoNotOptimize(read.second.data());
+        benchmark::ClobberMemory();
+        queue.commitRead(read.size());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(blockSize * sizeof(float)));
+}
+
+/** @brief Even threads produce and odd threads consume, bursts of 'range(0)' elements */
+template<typename Queue>
+static void Queue_ThreadedRange(benchmark::State &state)
+{
+    auto &queue = *SharedQueue<Queue>;
+    const bool isProducer = !(state.thread_index() % 2);
+    std::vector<std::size_t> values(static_cast<std::size_t>(state.range(0)));
+    std::size_t processed = 0;
+
+    for (auto _ : state) {
+        if (isProducer)
+            processed += queue.pushRange(values.begin(), values.end());
+        else
+            processed += queue.popRange(values.begin(), values.end());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(processed));
+}
+
+static void Queue_UnboundedBurst(benchmark::State &state)
+{
+    const auto burst = static_cast<std::size_t>(state.range(0));
+    Core::SPSCUnboundedQueue<std::size_t> queue;
+    std::size_t value = 0;
+
+    for (auto _ : state) {
+        for (auto i = 0ul; i < burst; ++i)
+            queue.push(i);
+        for (auto i = 0ul; i < burst; ++i)
+            benchmark::DoNotOptimize(queue.pop(value));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(burst));
+}
+
+using AudioBlock = std::array<float, 256>;
+
+/** @brief Fan-out an audio block to 'range(0)' readers by copying it into one SPSC queue per reader */
+static void Queue_FanOutCopy(benchmark::State &state)
+{
+    const auto readerCount = static_cast<std::size_t>(state.range(0));
+    std::vector<std::unique_ptr<Core::SPSCQueue<AudioBlock>>> queues;
+    AudioBlock block {};
+
+    for (auto i = 0ul; i < readerCount; ++i)
+        queues.push_back(std::make_unique<Core::SPSCQueue<AudioBlock>>(16));
+    for (auto _ : state) {
+        block.front() += 1.0f;
+        for (auto &queue : queues)
+            benchmark::DoNotOptimize(queue->push(block));
+        for (auto &queue : queues)
+            benchmark::DoNotOptimize(queue->pop(block));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(readerCount));
+}
+
+/** @brief Fan-out an audio block to 'range(0)' readers through a single broadcast ring */
+static void Queue_FanOutBroadcast(benchmark::State &state)
+{
+    const auto readerCount = static_cast<std::size_t>(state.range(0));
+    Core::BroadcastRing<AudioBlock> ring(16, readerCount);
+    std::vector<Core::BroadcastRing<AudioBlock>::ReaderID> readers;
+    AudioBlock block {};
+
+    for (auto i = 0ul; i < readerCount; ++i)
+        readers.push_back(ring.subscribe());
+    for (auto _ : state) {
+        block.front() += 1.0f;
+        benchmark::DoNotOptimize(ring.push(block));
+        for (const auto reader : readers)
+            benchmark::DoNotOptimize(ring.pop(reader, block));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(readerCount));
+}
+
+/** @brief Even threads produce and odd threads consume, a single thread does both */
+template<typename Queue>
+static void Queue_Threaded(benchmark::State &state)
+{
+    auto &queue = *SharedQueue<Queue>;
+    const bool isSingle = state.threads() == 1;
+    const bool isProducer = !(state.thread_index() % 2);
+    std::size_t processed = 0;
+    std::size_t value = 0;
+
+    for (auto _ : state) {
+        if (isSingle) {
+            processed += queue.push(value);
+            processed += queue.pop(value);
+        } else if (isProducer)
+            processed += queue.push(value);
+        else
+            processed += queue.pop(value);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(processed));
+}
+
+/** @brief The first thread drains the queue by batches of 'range(0)' while every other thread produces */
+template<typename Queue>
+static void Queue_ManyToOne(benchmark::State &state)
+{
+    auto &queue = *SharedQueue<Queue>;
+    const bool isConsumer = !state.thread_index();
+    std::vector<std::size_t> values(static_cast<std::size_t>(state.range(0)));
+    std::size_t processed = 0;
+
+    for (auto _ : state) {
+        if (isConsumer)
+            processed += queue.popRange(values.begin(), values.end());
+        else
+            processed += queue.push(processed);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(processed));
+}
+
+/** @brief Even threads produce and odd threads consume using blocking operations */
+template<typename Queue>
+static void Queue_Blocking(benchmark::State &state)
+{
+    auto &queue = *SharedQueue<Queue>;
+    const bool isProducer = !(state.thread_index() % 2);
+    std::size_t value = 0;
+
+    for (auto _ : state) {
+        if (isProducer)
+            queue.pushWait(value);
+        else
+            queue.popWait(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Queue>
+static void Queue_SetupShared(const benchmark::State &)
+{
+    SharedQueue<Queue> = std::make_unique<Queue>(QueueCapacity);
+}
+
+template<typename Queue>
+static void Queue_TeardownShared(const benchmark::State &)
+{
+    SharedQueue<Queue>.reset();
+}
+
+BENCHMARK_TEMPLATE(Queue_PushPop, MutexQueue<std::size_t>);
+BENCHMARK_TEMPLATE(Queue_PushPop, Core::SPSCQueue<std::size_t>);
+BENCHMARK_TEMPLATE(Queue_PushPop, Core::MPMCQueue<std::size_t>);
+
+BENCHMARK_TEMPLATE(Queue_Burst, MutexQueue<std::size_t>)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK_TEMPLATE(Queue_Burst, Core::SPSCQueue<std::size_t>)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK_TEMPLATE(Queue_Burst, Core::MPMCQueue<std::size_t>)->RangeMultiplier(4)->Range(4, 1024);
+
+BENCHMARK(Queue_BlockCopy)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK(Queue_BlockInPlace)->RangeMultiplier(4)->Range(64, 4096);
+
+BENCHMARK(Queue_FanOutCopy)->RangeMultiplier(2)->Range(1, 8);
+BENCHMARK(Queue_FanOutBroadcast)->RangeMultiplier(2)->Range(1, 8);
+
+BENCHMARK(Queue_UnboundedBurst)->RangeMultiplier(4)->Range(4, 16384);
+
+BENCHMARK_TEMPLATE(Queue_BurstRange, Core::SPSCQueue<std::size_t>)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK_TEMPLATE(Queue_BurstRange, Core::MPMCQueue<std::size_t>)->RangeMultiplier(4)->Range(4, 1024);
+
+#define REGISTER_THREADED_QUEUE_BENCHMARK(Queue, ThreadsSetup) \
+    BENCHMARK_TEMPLATE(Queue_Threaded, Queue)->ThreadsSetup->UseRealTime() \
+        ->Setup(Queue_SetupShared<Queue>)->Teardown(Queue_TeardownShared<Queue>);
+
+REGISTER_THREADED_QUEUE_BENCHMARK(MutexQueue<std::size_t>, ThreadRange(1, 16))
+REGISTER_THREADED_QUEUE_BENCHMARK(Core::SPSCQueue<std::size_t>, Threads(1)->Threads(2))
+REGISTER_THREADED_QUEUE_BENCHMARK(Core::MPMCQueue<std::size_t>, ThreadRange(1, 32))
+
+using PaddedMPMCQueue = Core::MPMCQueue<std::size_t, Core::NoWaitPolicy, Core::NoQueueStats, Core::PaddedCellLayout>;
+using ScrambledMPMCQueue = Core::MPMCQueue<std::size_t, Core::NoWaitPolicy, Core::NoQueueStats, Core::ScrambledCellLayout>;
+
+// Scaling of the cell layouts under contention, compare with the packed layout above
+REGISTER_THREADED_QUEUE_BENCHMARK(PaddedMPMCQueue, Threads(8)->Threads(16)->Threads(32))
+REGISTER_THREADED_QUEUE_BENCHMARK(ScrambledMPMCQueue, Threads(8)->Threads(16)->Threads(32))
+
+BENCHMARK_TEMPLATE(Queue_ThreadedRange, Core::MPMCQueue<std::size_t>)->Arg(16)->Arg(256)->ThreadRange(2, 16)->UseRealTime()
+    ->Setup(Queue_SetupShared<Core::MPMCQueue<std::size_t>>)->Teardown(Queue_TeardownShared<Core::MPMCQueue<std::size_t>>);
+
+BENCHMARK_TEMPLATE(Queue_ManyToOne, Core::MPMCQueue<std::size_t>)->Arg(1)->Arg(64)->ThreadRange(2, 16)->UseRealTime()
+    ->Setup(Queue_SetupShared<Core::MPMCQueue<std::size_t>>)->Teardown(Queue_TeardownShared<Core::MPMCQueue<std::size_t>>);
+BENCHMARK_TEMPLATE(Queue_ManyToOne, Core::MPSCQueue<std::size_t>)->Arg(1)->Arg(64)->ThreadRange(2, 16)->UseRealTime()
+    ->Setup(Queue_SetupShared<Core::MPSCQueue<std::size_t>>)->Teardown(Queue_TeardownShared<Core::MPSCQueue<std::size_t>>);
+
+using BlockingSPSCQueue = Core::SPSCQueue<std::size_t, Core::SpinParkWaitPolicy<>>;
+using BlockingMPMCQueue = Core::MPMCQueue<std::size_t, Core::SpinParkWaitPolicy<>>;
+
+BENCHMARK_TEMPLATE(Queue_Blocking, BlockingSPSCQueue)->Threads(2)->UseRealTime()->Iterations(1 << 20)
+    ->Setup(Queue_SetupShared<BlockingSPSCQueue>)->Teardown(Queue_TeardownShared<BlockingSPSCQueue>);
+BENCHMARK_TEMPLATE(Queue_Blocking, BlockingMPMCQueue)->ThreadRange(2, 8)->UseRealTime()->Iterations(1 << 18)
+    ->Setup(Queue_SetupShared<BlockingMPMCQueue>)->Teardown(Queue_TeardownShared<BlockingMPMCQueue>);
@@ -0,0 +1,54 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the work-stealing scheduler
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Core/Scheduler.hpp>
+
+namespace
+{
+    void Fibonacci(Core::Scheduler &scheduler, const std::size_t n, std::atomic<std::size_t> &result)
+    {
+        if (n < 2) {
+            result.fetch_add(n, std::memory_order_relaxed);
+            return;
+        }
+        const auto parent = Core::Scheduler::CurrentTask();
+        scheduler.dispatch([&scheduler, n, &result] { Fibonacci(scheduler, n - 1, result); }, parent);
+        scheduler.dispatch([&scheduler, n, &result] { Fibonacci(scheduler, n - 2, result); }, parent);
+    }
+}
+
+static void Scheduler_ParallelFor(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(1));
+    Core::Scheduler scheduler(static_cast<std::size_t>(state.range(0)));
+    std::atomic<std::size_t> sum { 0 };
+
+    for (auto _ : state) {
+        const auto root = scheduler.create([] {});
+        for (auto i = 0ul; i < count; ++i)
+            scheduler.dispatch([&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); }, root);
+        scheduler.submit(root);
+        scheduler.wait(root);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+static void Scheduler_Fibonacci(benchmark::State &state)
+{
+    Core::Scheduler scheduler(static_cast<std::size_t>(state.range(0)));
+    std::atomic<std::size_t> result { 0 };
+
+    for (auto _ : state) {
+        const auto root = scheduler.create([&scheduler, &result] { Fibonacci(scheduler, 18, result); });
+        scheduler.submit(root);
+        scheduler.wait(root);
+    }
+    benchmark::DoNotOptimize(result.load());
+}
+
+BENCHMARK(Scheduler_ParallelFor)->ArgsProduct({ { 1, 2, 4, 8 }, { 64, 4096 } })->UseRealTime();
+BENCHMARK(Scheduler_Fibonacci)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
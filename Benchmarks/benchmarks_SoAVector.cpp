@@ -0,0 +1,58 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the structure of arrays vector against a vector of structures
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Core/SoAVector.hpp>
+#include <Core/Vector.hpp>
+
+namespace
+{
+    /** @brief Voice-like state, a DSP loop only reads the gain and the envelope */
+    struct Voice
+    {
+        float gain {};
+        float envelope {};
+        double phase {};
+        std::uint32_t note {};
+        std::uint32_t flags {};
+        float params[8] {};
+    };
+}
+
+static void SoAVector_AoSFieldLoop(benchmark::State &state)
+{
+    Core::Vector<Voice> voices;
+
+    for (auto i = 0; i < state.range(0); ++i)
+        voices.push(Voice { 1.0f, 0.5f, 0.0, static_cast<std::uint32_t>(i), 0u, {} });
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto &voice : voices)
+            sum += voice.gain * voice.envelope;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void SoAVector_SoAFieldLoop(benchmark::State &state)
+{
+    Core::SoAVector<float, float, double, std::uint32_t, std::uint32_t> voices;
+
+    for (auto i = 0; i < state.range(0); ++i)
+        voices.push(1.0f, 0.5f, 0.0, static_cast<std::uint32_t>(i), 0u);
+    for (auto _ : state) {
+        const auto gains = voices.get<0>();
+        const auto envelopes = voices.get<1>();
+        float sum = 0.0f;
+        for (auto i = 0ul; i < gains.size(); ++i)
+            sum += gains[i] * envelopes[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(SoAVector_AoSFieldLoop)->RangeMultiplier(16)->Range(64, 1 << 16);
+BENCHMARK(SoAVector_SoAFieldLoop)->RangeMultiplier(16)->Range(64, 1 << 16);
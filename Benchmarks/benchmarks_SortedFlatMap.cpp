@@ -0,0 +1,76 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the sorted flat map against a sorted vector of pairs
+ */
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/SortedFlatMap.hpp>
+#include <Core/SortedVector.hpp>
+
+namespace
+{
+    /** @brief Parameter-like payload, a few cachelines per element when stored beside its key */
+    struct Payload
+    {
+        std::array<float, 15> data {};
+    };
+
+    using Pair = std::pair<std::uint32_t, Payload>;
+
+    /** @brief Order pairs by key only */
+    struct PairLess
+    {
+        [[nodiscard]] bool operator()(const Pair &lhs, const Pair &rhs) const noexcept { return lhs.first < rhs.first; }
+        [[nodiscard]] bool operator()(const Pair &lhs, const std::uint32_t rhs) const noexcept { return lhs.first < rhs; }
+        [[nodiscard]] bool operator()(const std::uint32_t lhs, const Pair &rhs) const noexcept { return lhs < rhs.first; }
+    };
+
+    using PairVector = Core::SortedVector<Pair, std::size_t, PairLess>;
+    using FlatMap = Core::SortedFlatMap<std::uint32_t, Payload>;
+
+    /** @brief Generate a deterministic set of keys */
+    [[nodiscard]] std::vector<std::uint32_t> MakeKeys(const std::size_t count)
+    {
+        std::mt19937 engine(42);
+        std::vector<std::uint32_t> keys(count);
+        for (auto &key : keys)
+            key = static_cast<std::uint32_t>(engine());
+        return keys;
+    }
+
+    inline void Insert(PairVector &container, const std::uint32_t key) { container.push(Pair(key, Payload {})); }
+    inline void Insert(FlatMap &container, const std::uint32_t key) { container.tryEmplace(key); }
+
+    [[nodiscard]] inline float Lookup(const PairVector &container, const std::uint32_t key)
+        { return container.find(key)->second.data[0]; }
+    [[nodiscard]] inline float Lookup(const FlatMap &container, const std::uint32_t key)
+        { return container.find(key)->second.data[0]; }
+}
+
+template<typename Container>
+static void SortedFlatMap_Lookup(benchmark::State &state)
+{
+    auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+    Container container;
+
+    for (const auto key : keys)
+        Insert(container, key);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(24));
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto key : keys)
+            sum += Lookup(container, key);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(SortedFlatMap_Lookup, PairVector)->RangeMultiplier(16)->Range(64, 1 << 16);
+BENCHMARK_TEMPLATE(SortedFlatMap_Lookup, FlatMap)->RangeMultiplier(16)->Range(64, 1 << 16);
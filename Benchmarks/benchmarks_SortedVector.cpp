@@ -0,0 +1,167 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the sorted vector family against standard sorted containers
+ */
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/EytzingerArray.hpp>
+#include <Core/SortedVector.hpp>
+#include <Core/SortedFlatVector.hpp>
+#include <Core/SortedSmallVector.hpp>
+
+namespace
+{
+    /** @brief Generate a deterministic set of random keys */
+    [[nodiscard]] std::vector<std::uint32_t> MakeKeys(const std::size_t count)
+    {
+        std::mt19937 engine(42);
+        std::vector<std::uint32_t> keys(count);
+        for (auto &key : keys)
+            key = static_cast<std::uint32_t>(engine());
+        return keys;
+    }
+
+    /** @brief std::vector kept sorted with binary search insertion */
+    struct StdSortedVector
+    {
+        std::vector<std::uint32_t> data;
+
+        void push(const std::uint32_t value)
+            { data.insert(std::upper_bound(data.begin(), data.end(), value), value); }
+
+        void insert(const std::uint32_t *from, const std::uint32_t *to)
+        {
+            const auto middle = data.insert(data.end(), from, to);
+            std::sort(middle, data.end());
+            std::inplace_merge(data.begin(), middle, data.end());
+        }
+
+        [[nodiscard]] bool contains(const std::uint32_t value) const
+            { return std::binary_search(data.begin(), data.end(), value); }
+    };
+
+    /** @brief std::multiset baseline */
+    struct StdMultiset
+    {
+        std::multiset<std::uint32_t> data;
+
+        void push(const std::uint32_t value) { data.insert(value); }
+
+        void insert(const std::uint32_t *from, const std::uint32_t *to) { data.insert(from, to); }
+
+        [[nodiscard]] bool contains(const std::uint32_t value) const { return data.find(value) != data.end(); }
+    };
+
+    template<typename Container>
+    [[nodiscard]] bool Contains(const Container &container, const std::uint32_t value)
+    {
+        return container.contains(value);
+    }
+
+    template<typename Type>
+    using SortedSmallVector16 = Core::SortedSmallVector<Type, 16>;
+}
+
+template<typename Container>
+static void SortedVector_Push(benchmark::State &state)
+{
+    const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Container container;
+        for (const auto key : keys)
+            container.push(key);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+static void SortedVector_InsertBatch(benchmark::State &state)
+{
+    constexpr auto BatchSize = 64;
+    const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Container container;
+        for (auto i = 0ul; i < keys.size(); i += BatchSize) {
+            const auto count = std::min<std::size_t>(BatchSize, keys.size() - i);
+            container.insert(keys.data() + i, keys.data() + i + count);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+static void SortedVector_Lookup(benchmark::State &state)
+{
+    const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+    Container container;
+
+    for (const auto key : keys)
+        container.push(key);
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (const auto key : keys)
+            found += Contains(container, key);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define REGISTER_SORTED_BENCHMARKS(Function) \
+    BENCHMARK_TEMPLATE(Function, StdSortedVector)->RangeMultiplier(8)->Range(8, 8 << 9); \
+    BENCHMARK_TEMPLATE(Function, StdMultiset)->RangeMultiplier(8)->Range(8, 8 << 9); \
+    BENCHMARK_TEMPLATE(Function, Core::SortedVector<std::uint32_t>)->RangeMultiplier(8)->Range(8, 8 << 9); \
+    BENCHMARK_TEMPLATE(Function, Core::SortedTinyVector<std::uint32_t>)->RangeMultiplier(8)->Range(8, 8 << 9); \
+    BENCHMARK_TEMPLATE(Function, Core::SortedFlatVector<std::uint32_t>)->RangeMultiplier(8)->Range(8, 8 << 9); \
+    BENCHMARK_TEMPLATE(Function, SortedSmallVector16<std::uint32_t>)->RangeMultiplier(8)->Range(8, 8 << 9);
+
+REGISTER_SORTED_BENCHMARKS(SortedVector_Push)
+REGISTER_SORTED_BENCHMARKS(SortedVector_InsertBatch)
+REGISTER_SORTED_BENCHMARKS(SortedVector_Lookup)
+
+/** @brief Lookups in sets larger than the caches */
+template<typename Container>
+static void SortedVector_LookupLarge(benchmark::State &state)
+{
+    const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+    Core::SortedVector<std::uint32_t> sorted;
+    std::vector<std::uint32_t> lookups(keys.begin(), keys.end());
+
+    sorted.insert(keys.begin(), keys.end());
+    std::shuffle(lookups.begin(), lookups.end(), std::mt19937(24));
+    const Container container(sorted);
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (const auto key : lookups)
+            found += container.contains(key);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+namespace
+{
+    /** @brief std::binary_search over a sorted std::vector */
+    struct StdBinarySearch
+    {
+        explicit StdBinarySearch(const Core::SortedVector<std::uint32_t> &sorted) : data(sorted.begin(), sorted.end()) {}
+
+        [[nodiscard]] bool contains(const std::uint32_t value) const
+            { return std::binary_search(data.begin(), data.end(), value); }
+
+        std::vector<std::uint32_t> data;
+    };
+}
+
+BENCHMARK_TEMPLATE(SortedVector_LookupLarge, StdBinarySearch)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK_TEMPLATE(SortedVector_LookupLarge, Core::SortedVector<std::uint32_t>)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK_TEMPLATE(SortedVector_LookupLarge, Core::EytzingerArray<std::uint32_t>)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
@@ -0,0 +1,113 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the string family against std::string
+ */
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/String.hpp>
+#include <Core/FlatString.hpp>
+#include <Core/SmallString.hpp>
+
+namespace
+{
+    constexpr auto ShortStr = "Gain";
+    constexpr auto LongStr = "Oscillator/Voice/Filter/Cutoff/Frequency/Modulation";
+
+    template<typename StringType>
+    inline void Append(StringType &str, const char * const cstring)
+    {
+        str += cstring;
+    }
+
+    inline bool Contains(const std::string &str, const std::string_view &value)
+    {
+        return str.find(value) != std::string::npos;
+    }
+
+    template<typename StringType>
+    inline bool Contains(const StringType &str, const std::string_view &value)
+    {
+        return str.find(value) != str.end();
+    }
+
+    /** @brief Select a literal from the benchmark argument */
+    [[nodiscard]] inline const char *SelectLiteral(const benchmark::State &state)
+    {
+        return state.range(0) ? LongStr : ShortStr;
+    }
+}
+
+template<typename StringType>
+static void String_Construct(benchmark::State &state)
+{
+    const auto literal = SelectLiteral(state);
+
+    for (auto _ : state) {
+        StringType str(literal);
+        benchmark::DoNotOptimize(str.data());
+    }
+}
+
+template<typename StringType>
+static void String_Append(benchmark::State &state)
+{
+    const auto literal = SelectLiteral(state);
+
+    for (auto _ : state) {
+        StringType str;
+        for (auto i = 0; i < 16; ++i)
+            Append(str, literal);
+        benchmark::DoNotOptimize(str.data());
+    }
+}
+
+template<typename StringType>
+static void String_Compare(benchmark::State &state)
+{
+    const auto literal = SelectLiteral(state);
+    const StringType lhs(literal), rhs(literal);
+
+    for (auto _ : state) {
+        const bool res = lhs == rhs;
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+template<typename StringType>
+static void String_Find(benchmark::State &state)
+{
+    const StringType str(SelectLiteral(state));
+    const std::string_view needle = state.range(0) ? "Modulation" : "ain";
+
+    for (auto _ : state) {
+        const bool res = Contains(str, needle);
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+template<typename StringType>
+static void String_Copy(benchmark::State &state)
+{
+    const StringType str(SelectLiteral(state));
+
+    for (auto _ : state) {
+        StringType copy(str);
+        benchmark::DoNotOptimize(copy.data());
+    }
+}
+
+#define REGISTER_STRING_BENCHMARKS(Function) \
+    BENCHMARK_TEMPLATE(Function, std::string)->Arg(0)->Arg(1); \
+    BENCHMARK_TEMPLATE(Function, Core::String)->Arg(0)->Arg(1); \
+    BENCHMARK_TEMPLATE(Function, Core::TinyString)->Arg(0)->Arg(1); \
+    BENCHMARK_TEMPLATE(Function, Core::FlatString)->Arg(0)->Arg(1); \
+    BENCHMARK_TEMPLATE(Function, Core::SmallString)->Arg(0)->Arg(1);
+
+REGISTER_STRING_BENCHMARKS(String_Construct)
+REGISTER_STRING_BENCHMARKS(String_Append)
+REGISTER_STRING_BENCHMARKS(String_Compare)
+REGISTER_STRING_BENCHMARKS(String_Find)
+REGISTER_STRING_BENCHMARKS(String_Copy)
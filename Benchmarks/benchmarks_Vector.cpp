@@ -0,0 +1,272 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of the vector family against std::vector
+ */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Core/Arena.hpp>
+#include <Core/AllocatedVector.hpp>
+#include <Core/Vector.hpp>
+#include <Core/FlatVector.hpp>
+#include <Core/SmallVector.hpp>
+
+namespace
+{
+    constexpr auto LongStr = "Benchmark string long enough to defeat small string optimization";
+
+    /** @brief Detect std::vector to switch between API flavors */
+    template<typename Container>
+    constexpr bool IsStdVector = false;
+
+    template<typename Type, typename Allocator>
+    constexpr bool IsStdVector<std::vector<Type, Allocator>> = true;
+
+    /** @brief Create the i-th benchmark value of a given type */
+    template<typename Type>
+    [[nodiscard]] Type MakeValue(const std::size_t i)
+    {
+        if constexpr (std::is_same_v<Type, std::string>)
+            return std::string(LongStr) + std::to_string(i);
+        else
+            return static_cast<Type>(i);
+    }
+
+    template<typename Container, typename Value>
+    inline void Push(Container &container, Value &&value)
+    {
+        if constexpr (IsStdVector<Container>)
+            container.push_back(std::forward<Value>(value));
+        else
+            container.push(std::forward<Value>(value));
+    }
+
+    template<typename Container>
+    [[nodiscard]] Container MakeContainer(const std::size_t count)
+    {
+        using Type = std::remove_reference_t<decltype(*std::declval<Container &>().begin())>;
+
+        Container container;
+        container.reserve(static_cast<decltype(container.size())>(count));
+        for (auto i = 0ul; i < count; ++i)
+            Push(container, MakeValue<Type>(i));
+        return container;
+    }
+
+    /** @brief Small vector with a cache large enough for typical audio-graph node lists */
+    template<typename Type>
+    using SmallVector16 = Core::SmallVector<Type, 16>;
+
+    /** @brief Scratch vector allocated from the thread-local arena */
+    template<typename Type>
+    using ArenaVector = Core::AllocatedVector<Type, &Core::ArenaAlloc, &Core::ArenaFree>;
+
+    /** @brief Vector of integers with a custom growth policy */
+    template<typename GrowthPolicy>
+    using GrowthVector = Core::Vector<std::size_t, std::size_t, GrowthPolicy>;
+}
+
+template<typename Container>
+static void Vector_Grow(benchmark::State &state)
+{
+    using Type = std::remove_reference_t<decltype(*std::declval<Container &>().begin())>;
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Container container;
+        for (auto i = 0ul; i < count; ++i)
+            Push(container, MakeValue<Type>(i));
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+/** @brief Grow a vector of vectors, which relocates the inner vectors on each reallocation */
+template<typename Container>
+static void Vector_GrowNested(benchmark::State &state)
+{
+    using Type = std::remove_reference_t<decltype(*std::declval<Container &>().begin())>;
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Container container;
+        for (auto i = 0ul; i < count; ++i)
+            Push(container, Type { i, i + 1, i + 2, i + 3 });
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+/** @brief Grow a vector and report the memory left unused by its growth policy */
+template<typename Container>
+static void Vector_GrowthPolicy(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::size_t reallocations = 0;
+    std::size_t unused = 0;
+
+    for (auto _ : state) {
+        Container container;
+        reallocations = 0;
+        for (auto i = 0ul; i < count; ++i) {
+            if (container.size() == container.capacity())
+                ++reallocations;
+            container.push(i);
+        }
+        unused = container.capacity() - container.size();
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    state.counters["reallocations"] = static_cast<double>(reallocations);
+    state.counters["unused_bytes"] = static_cast<double>(unused * sizeof(std::size_t));
+}
+
+template<typename Container>
+static void Vector_ScratchGrow(benchmark::State &state)
+{
+    using Type = std::remove_reference_t<decltype(*std::declval<Container &>().begin())>;
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto &arena = Core::Arena::Local();
+
+    for (auto _ : state) {
+        Core::Arena::Scope scope(arena);
+        Container container;
+        for (auto i = 0ul; i < count; ++i)
+            Push(container, MakeValue<Type>(i));
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+template<typename Container>
+static void Vector_Push(benchmark::State &state)
+{
+    using Type = std::remove_reference_t<decltype(*std::declval<Container &>().begin())>;
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Container container;
+        container.reserve(static_cast<decltype(container.size())>(count));
+        for (auto i = 0ul; i < count; ++i)
+            Push(container, MakeValue<Type>(i));
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+template<typename Container>
+static void Vector_InsertMiddle(benchmark::State &state)
+{
+    using Type = std::remove_reference_t<decltype(*std::declval<Container &>().begin())>;
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto value = MakeValue<Type>(42);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = MakeContainer<Container>(count);
+        state.ResumeTiming();
+        for (auto i = 0ul; i < 16ul; ++i)
+            container.insert(container.begin() + container.size() / 2, value);
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+
+template<typename Container>
+static void Vector_EraseFront(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = MakeContainer<Container>(count);
+        state.ResumeTiming();
+        for (auto i = 0ul; i < 16ul && !container.empty(); ++i)
+            container.erase(container.begin());
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+
+template<typename Container>
+static void Vector_Resize(benchmark::State &state)
+{
+    using Type = std::remove_reference_t<decltype(*std::declval<Container &>().begin())>;
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto value = MakeValue<Type>(42);
+
+    for (auto _ : state) {
+        Container container;
+        container.resize(static_cast<decltype(container.size())>(count), value);
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+template<typename Container>
+static void Vector_Iterate(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto container = MakeContainer<Container>(count);
+
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto &elem : container) {
+            if constexpr (std::is_same_v<std::remove_cv_t<std::remove_reference_t<decltype(elem)>>, std::string>)
+                sum += elem.size();
+            else
+                sum += static_cast<std::size_t>(elem);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+#define REGISTER_VECTOR_BENCHMARK(Function, Container) \
+    BENCHMARK_TEMPLATE(Function, Container)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+#define REGISTER_VECTOR_BENCHMARKS(Function, Type) \
+    REGISTER_VECTOR_BENCHMARK(Function, std::vector<Type>) \
+    REGISTER_VECTOR_BENCHMARK(Function, Core::Vector<Type>) \
+    REGISTER_VECTOR_BENCHMARK(Function, Core::TinyVector<Type>) \
+    REGISTER_VECTOR_BENCHMARK(Function, Core::FlatVector<Type>) \
+    REGISTER_VECTOR_BENCHMARK(Function, SmallVector16<Type>)
+
+REGISTER_VECTOR_BENCHMARKS(Vector_Grow, std::size_t)
+REGISTER_VECTOR_BENCHMARKS(Vector_Grow, std::string)
+REGISTER_VECTOR_BENCHMARKS(Vector_Push, std::size_t)
+REGISTER_VECTOR_BENCHMARKS(Vector_Push, std::string)
+REGISTER_VECTOR_BENCHMARKS(Vector_InsertMiddle, std::size_t)
+REGISTER_VECTOR_BENCHMARKS(Vector_InsertMiddle, std::string)
+REGISTER_VECTOR_BENCHMARKS(Vector_EraseFront, std::size_t)
+REGISTER_VECTOR_BENCHMARKS(Vector_EraseFront, std::string)
+REGISTER_VECTOR_BENCHMARKS(Vector_Resize, std::size_t)
+REGISTER_VECTOR_BENCHMARKS(Vector_Resize, std::string)
+REGISTER_VECTOR_BENCHMARKS(Vector_Iterate, std::size_t)
+REGISTER_VECTOR_BENCHMARKS(Vector_Iterate, std::string)
+
+REGISTER_VECTOR_BENCHMARK(Vector_ScratchGrow, Core::Vector<std::size_t>)
+REGISTER_VECTOR_BENCHMARK(Vector_ScratchGrow, ArenaVector<std::size_t>)
+
+#define REGISTER_GROWTH_POLICY_BENCHMARK(Container) \
+    BENCHMARK_TEMPLATE(Vector_GrowthPolicy, Container)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+REGISTER_GROWTH_POLICY_BENCHMARK(Core::Vector<std::size_t>)
+REGISTER_GROWTH_POLICY_BENCHMARK(GrowthVector<Core::HalfGrowthPolicy>)
+REGISTER_GROWTH_POLICY_BENCHMARK(GrowthVector<Core::PageGrowthPolicy<>>)
+REGISTER_GROWTH_POLICY_BENCHMARK(GrowthVector<Core::StepGrowthPolicy<1024>>)
+
+REGISTER_VECTOR_BENCHMARK(Vector_GrowNested, std::vector<std::vector<std::size_t>>)
+REGISTER_VECTOR_BENCHMARK(Vector_GrowNested, Core::Vector<Core::Vector<std::size_t>>)
+REGISTER_VECTOR_BENCHMARK(Vector_GrowNested, Core::Vector<Core::FlatVector<std::size_t>>)
+REGISTER_VECTOR_BENCHMARK(Vector_GrowNested, Core::Vector<SmallVector16<std::size_t>>)
+
+#define REGISTER_LARGE_GROW_BENCHMARK(Container) \
+    BENCHMARK_TEMPLATE(Vector_Grow, Container)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 22);
+
+REGISTER_LARGE_GROW_BENCHMARK(std::vector<std::size_t>)
+REGISTER_LARGE_GROW_BENCHMARK(Core::Vector<std::size_t>)
+REGISTER_LARGE_GROW_BENCHMARK(Core::FlatVector<std::size_t>)
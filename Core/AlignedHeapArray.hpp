@@ -0,0 +1,130 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: A runtime array aligned and padded for SIMD
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#include "AllocPolicy.hpp"
+#include "Assert.hpp"
+#include "Utils.hpp"
+
+namespace Core
+{
+    template<typename Type, std::size_t Alignment = CacheLineSize, typename AllocPolicy = DefaultAllocPolicy>
+    class AlignedHeapArray;
+
+    /** @brief Buffer of audio samples, aligned and padded to a cacheline */
+    template<typename Type = float, std::size_t Alignment = CacheLineSize, typename AllocPolicy = DefaultAllocPolicy>
+    using AudioBuffer = AlignedHeapArray<Type, Alignment, AllocPolicy>;
+}
+
+/**
+ * @brief Runtime sized array of trivial elements, its data is aligned to 'Alignment'
+ *  The allocation is padded up to a multiple of 'Alignment' bytes and the padding is zeroed,
+ *  so SIMD loops can process 'paddedSize()' elements without a scalar tail
+ *
+ * @tparam Type Type of element, must be trivially copyable
+ * @tparam Alignment Alignment of the data and SIMD width of the padding, in bytes
+ * @tparam AllocPolicy Policy allocating the array, LargeAllocPolicy backs large arrays with huge pages
+ */
+template<typename Type, std::size_t Alignment, typename AllocPolicy>
+class alignas_quarter_cacheline Core::AlignedHeapArray
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type> && std::is_trivially_destructible_v<Type>,
+        "Core::AlignedHeapArray: Type must be trivially copyable and destructible");
+    static_assert(Alignment && !(Alignment & (Alignment - 1)), "Core::AlignedHeapArray: Alignment must be a power of 2");
+    static_assert(Alignment >= alignof(Type) && !(Alignment % sizeof(Type)),
+        "Core::AlignedHeapArray: Alignment must be a multiple of the size of Type");
+
+    using Iterator = Type *;
+    using ConstIterator = const Type *;
+
+    /** @brief Number of elements in 'Alignment' bytes */
+    static constexpr std::size_t ElementsPerAlignment = Alignment / sizeof(Type);
+
+    /** @brief Default construct an empty array */
+    AlignedHeapArray(void) noexcept = default;
+
+    /** @brief Construct an array of value initialized elements */
+    AlignedHeapArray(const std::size_t size) noexcept_ndebug { allocate(size); }
+
+    /** @brief Construct an array filled with a value */
+    AlignedHeapArray(const std::size_t size, const Type &value) noexcept_ndebug { allocate(size, value); }
+
+    /** @brief Move constructor */
+    AlignedHeapArray(AlignedHeapArray &&other) noexcept { swap(other); }
+
+    /** @brief Destruct the array */
+    ~AlignedHeapArray(void) noexcept { release(); }
+
+    /** @brief Move assignment */
+    AlignedHeapArray &operator=(AlignedHeapArray &&other) noexcept { swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(AlignedHeapArray &other) noexcept { std::swap(_data, other._data); std::swap(_size, other._size); }
+
+
+    /** @brief Fast check if array contains data */
+    operator bool(void) const noexcept { return !empty(); }
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+
+    /** @brief Allocate a new array of value initialized elements */
+    void allocate(const std::size_t size) noexcept_ndebug;
+
+    /** @brief Allocate a new array filled with a value */
+    void allocate(const std::size_t size, const Type &value) noexcept_ndebug;
+
+    /** @brief Allocate a new array without initializing its elements, only the padding is zeroed
+     *  Use it when every element is written right after (ex: decoding samples) */
+    void allocateUninitialized(const std::size_t size) noexcept_ndebug;
+
+    /** @brief Release memory */
+    void release(void) noexcept;
+
+
+    /** @brief Get internal data, aligned to 'Alignment' */
+    [[nodiscard]] Type *data(void) noexcept { return _data; }
+    [[nodiscard]] const Type *data(void) const noexcept { return _data; }
+
+
+    /** @brief Get array length */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _size; }
+
+    /** @brief Get array length rounded up to a multiple of 'ElementsPerAlignment', the padding elements are zero */
+    [[nodiscard]] std::size_t paddedSize(void) const noexcept { return PaddedSize(_size); }
+
+
+    /** @brief Helpers to access data */
+    [[nodiscard]] Type &at(const std::size_t index) noexcept { return _data[index]; }
+    [[nodiscard]] const Type &at(const std::size_t index) const noexcept { return _data[index]; }
+    [[nodiscard]] Type &operator[](const std::size_t index) noexcept { return _data[index]; }
+    [[nodiscard]] const Type &operator[](const std::size_t index) const noexcept { return _data[index]; }
+
+
+    /** Iterators */
+    [[nodiscard]] Iterator begin(void) noexcept { return data(); }
+    [[nodiscard]] Iterator end(void) noexcept { return data() + size(); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return data(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return data() + size(); }
+
+private:
+    Type *_data { nullptr };
+    std::size_t _size { 0 };
+
+    /** @brief Round a size up to a multiple of 'ElementsPerAlignment' */
+    [[nodiscard]] static constexpr std::size_t PaddedSize(const std::size_t size) noexcept
+        { return (size + ElementsPerAlignment - 1) & ~(ElementsPerAlignment - 1); }
+
+    /** @brief Reuse or reallocate the buffer for 'size' elements and zero its padding */
+    void reserveUninitialized(const std::size_t size) noexcept_ndebug;
+};
+
+#include "AlignedHeapArray.ipp"
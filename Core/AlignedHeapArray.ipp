@@ -0,0 +1,53 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: AlignedHeapArray
+ */
+
+template<typename Type, std::size_t Alignment, typename AllocPolicy>
+inline void Core::AlignedHeapArray<Type, Alignment, AllocPolicy>::allocate(const std::size_t size) noexcept_ndebug
+{
+    reserveUninitialized(size);
+    std::uninitialized_value_construct_n(_data, size);
+}
+
+template<typename Type, std::size_t Alignment, typename AllocPolicy>
+inline void Core::AlignedHeapArray<Type, Alignment, AllocPolicy>::allocate(const std::size_t size, const Type &value) noexcept_ndebug
+{
+    reserveUninitialized(size);
+    std::fill_n(_data, size, value);
+}
+
+template<typename Type, std::size_t Alignment, typename AllocPolicy>
+inline void Core::AlignedHeapArray<Type, Alignment, AllocPolicy>::allocateUninitialized(const std::size_t size) noexcept_ndebug
+{
+    reserveUninitialized(size);
+}
+
+template<typename Type, std::size_t Alignment, typename AllocPolicy>
+inline void Core::AlignedHeapArray<Type, Alignment, AllocPolicy>::release(void) noexcept
+{
+    if (!_data)
+        return;
+    AllocPolicy::Deallocate(_data, sizeof(Type) * PaddedSize(_size), Alignment);
+    _data = nullptr;
+    _size = 0;
+}
+
+template<typename Type, std::size_t Alignment, typename AllocPolicy>
+inline void Core::AlignedHeapArray<Type, Alignment, AllocPolicy>::reserveUninitialized(const std::size_t size) noexcept_ndebug
+{
+    const auto padded = PaddedSize(size);
+
+    if (padded != PaddedSize(_size)) {
+        // The policy needs the allocated size, so the buffer is released as soon as the padded size changes
+        release();
+        if (padded) {
+            _data = reinterpret_cast<Type *>(AllocPolicy::Allocate(sizeof(Type) * padded, Alignment));
+            coreAssert(_data,
+                throw std::runtime_error("Core::AlignedHeapArray::allocate: Malloc failed"));
+        }
+    }
+    _size = size;
+    if (padded != size)
+        std::memset(static_cast<void *>(_data + size), 0, sizeof(Type) * (padded - size));
+}
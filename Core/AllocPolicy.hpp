@@ -0,0 +1,39 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Memory allocation policies of the containers
+ */
+
+#pragma once
+
+#include "LargeAlloc.hpp"
+#include "Utils.hpp"
+
+namespace Core
+{
+    struct DefaultAllocPolicy;
+    struct LargeAllocPolicy;
+}
+
+/** @brief Allocate through the aligned heap */
+struct Core::DefaultAllocPolicy
+{
+    /** @brief Allocate 'bytes' aligned to 'alignment', nullptr on failure */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { return Utils::AlignedAlloc(bytes, alignment); }
+
+    /** @brief Release memory returned by 'Allocate' */
+    static void Deallocate(void * const data, const std::size_t, const std::size_t) noexcept
+        { Utils::AlignedFree(data); }
+};
+
+/** @brief Allocate large buffers on huge pages bound to the NUMA node of the allocating thread */
+struct Core::LargeAllocPolicy
+{
+    /** @brief Allocate 'bytes' aligned to 'alignment', nullptr on failure */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { return Utils::LargeAlloc(bytes, alignment); }
+
+    /** @brief Release memory returned by 'Allocate' */
+    static void Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+        { Utils::LargeFree(data, bytes, alignment); }
+};
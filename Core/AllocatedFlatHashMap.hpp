@@ -0,0 +1,26 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flat hash map using custom allocators
+ */
+
+#pragma once
+
+#include "FlatHashTableDetails.hpp"
+#include "AllocatedFlatHashTableBase.hpp"
+
+namespace Core
+{
+    /**
+     * @brief Open addressing hash map storing its pairs contiguously
+     * The map must take an allocator and a deallocator functor
+     *
+     * @tparam Key Key type
+     * @tparam Value Mapped type
+     * @tparam AllocateFunc Allocator
+     * @tparam DeallocateFunc Deallocator
+     * @tparam KeyHasher Transparent hash functor
+     * @tparam KeyCompare Transparent equality functor
+     */
+    template<typename Key, typename Value, auto AllocateFunc, auto DeallocateFunc, typename KeyHasher = Hasher, typename KeyCompare = KeyEqual>
+    using AllocatedFlatHashMap = Internal::FlatHashTableDetails<Internal::AllocatedFlatHashTableBase<AllocateFunc, DeallocateFunc>, Key, Value, KeyHasher, KeyCompare>;
+}
@@ -0,0 +1,25 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flat hash set using custom allocators
+ */
+
+#pragma once
+
+#include "FlatHashTableDetails.hpp"
+#include "AllocatedFlatHashTableBase.hpp"
+
+namespace Core
+{
+    /**
+     * @brief Open addressing hash set storing its keys contiguously
+     * The set must take an allocator and a deallocator functor
+     *
+     * @tparam Key Key type
+     * @tparam AllocateFunc Allocator
+     * @tparam DeallocateFunc Deallocator
+     * @tparam KeyHasher Transparent hash functor
+     * @tparam KeyCompare Transparent equality functor
+     */
+    template<typename Key, auto AllocateFunc, auto DeallocateFunc, typename KeyHasher = Hasher, typename KeyCompare = KeyEqual>
+    using AllocatedFlatHashSet = Internal::FlatHashTableDetails<Internal::AllocatedFlatHashTableBase<AllocateFunc, DeallocateFunc>, Key, void, KeyHasher, KeyCompare>;
+}
@@ -0,0 +1,28 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Base allocation of a flat hash table using custom allocators
+ */
+
+#pragma once
+
+#include "Utils.hpp"
+
+namespace Core::Internal
+{
+    template<auto AllocateFunc, auto DeallocateFunc>
+    class AllocatedFlatHashTableBase;
+}
+
+/** @brief Allocate the table through an allocator and a deallocator functor */
+template<auto AllocateFunc, auto DeallocateFunc>
+class Core::Internal::AllocatedFlatHashTableBase
+{
+protected:
+    /** @brief Allocates a new table */
+    [[nodiscard]] void *allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { return AllocateFunc(bytes, alignment); }
+
+    /** @brief Deallocates a table */
+    void deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+        { DeallocateFunc(data, bytes, alignment); }
+};
@@ -37,4 +37,15 @@ protected:
             ptr->customType.~CustomHeaderType();
         DeallocateFunc(ptr, sizeof(Header) + sizeof(Type) * capacity, alignof(Header));
     }
+
+    /** @brief Allocates a temporary buffer, used by algorithms requiring scratch memory */
+    [[nodiscard]] static Type *allocateScratch(const Range count) noexcept
+        { return reinterpret_cast<Type *>(AllocateFunc(sizeof(Type) * count, alignof(Type))); }
+
+    /** @brief Deallocates a temporary buffer */
+    static void deallocateScratch(Type * const data, const Range count) noexcept
+        { DeallocateFunc(data, sizeof(Type) * count, alignof(Type)); }
+
+    /** @brief Custom allocators can't resize a buffer */
+    [[nodiscard]] Type *reallocate(Type * const, const Range, const Range) noexcept { return nullptr; }
 };
@@ -33,4 +33,12 @@ protected:
         if (data != SmallVectorBase<Type, OptimizedCapacity, Range>::optimizedData())
             DeallocateFunc(data, sizeof(Type) * capacity, alignof(Type));
     }
+
+    /** @brief Allocates a temporary buffer, used by algorithms requiring scratch memory */
+    [[nodiscard]] static Type *allocateScratch(const Range count) noexcept
+        { return reinterpret_cast<Type *>(AllocateFunc(sizeof(Type) * count, alignof(Type))); }
+
+    /** @brief Deallocates a temporary buffer */
+    static void deallocateScratch(Type * const data, const Range count) noexcept
+        { DeallocateFunc(data, sizeof(Type) * count, alignof(Type)); }
 };
@@ -25,4 +25,15 @@ protected:
     /** @brief Deallocates a buffer */
     void deallocate(Type * const data, const Range capacity) noexcept
         { DeallocateFunc(data, sizeof(Type) * capacity, alignof(Type)); }
+
+    /** @brief Allocates a temporary buffer, used by algorithms requiring scratch memory */
+    [[nodiscard]] static Type *allocateScratch(const Range count) noexcept
+        { return reinterpret_cast<Type *>(AllocateFunc(sizeof(Type) * count, alignof(Type))); }
+
+    /** @brief Deallocates a temporary buffer */
+    static void deallocateScratch(Type * const data, const Range count) noexcept
+        { DeallocateFunc(data, sizeof(Type) * count, alignof(Type)); }
+
+    /** @brief Custom allocators can't resize a buffer */
+    [[nodiscard]] Type *reallocate(Type * const, const Range, const Range) noexcept { return nullptr; }
 };
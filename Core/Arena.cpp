@@ -0,0 +1,115 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Monotonic arena allocators
+ */
+
+#include <algorithm>
+#include <new>
+
+#include "Arena.hpp"
+
+using namespace Core;
+
+namespace
+{
+    thread_local Arena LocalArena {};
+    thread_local FrameArena LocalFrameArena {};
+}
+
+void *Core::ArenaAlloc(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    return LocalArena.allocate(bytes, alignment);
+}
+
+void *Core::FrameAlloc(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    return LocalFrameArena.allocate(bytes, alignment);
+}
+
+Arena &Arena::Local(void) noexcept
+{
+    return LocalArena;
+}
+
+FrameArena &FrameArena::Local(void) noexcept
+{
+    return LocalFrameArena;
+}
+
+Arena::~Arena(void) noexcept
+{
+    for (auto chunk = _first; chunk;) {
+        const auto next = chunk->next;
+        chunk->~Chunk();
+        Utils::AlignedFree(chunk);
+        chunk = next;
+    }
+}
+
+void *Arena::allocateSlow(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    const auto alignAddress = [alignment](std::byte * const data) {
+        return (reinterpret_cast<std::uintptr_t>(data) + alignment - 1) & -alignment;
+    };
+
+    // Look for a chunk kept from a previous reset
+    for (auto chunk = _current ? _current->next : _first; chunk; chunk = chunk->next) {
+        const auto address = alignAddress(chunk->begin());
+        if (address + bytes > reinterpret_cast<std::uintptr_t>(chunk->end))
+            continue;
+        _current = chunk;
+        _cursor = reinterpret_cast<std::byte *>(address + bytes);
+        _end = chunk->end;
+        return reinterpret_cast<void *>(address);
+    }
+
+    // Insert a new chunk after the current one
+    const auto padding = alignment > alignof(Chunk) ? alignment : 0ul;
+    const auto size = std::max(_chunkSize, bytes + padding);
+    const auto data = Utils::AlignedAlloc<alignof(Chunk), Chunk>(sizeof(Chunk) + size);
+    if (!data)
+        return nullptr;
+    const auto chunk = new (data) Chunk { nullptr, nullptr };
+    chunk->end = chunk->begin() + size;
+    if (_current) {
+        chunk->next = _current->next;
+        _current->next = chunk;
+    } else {
+        chunk->next = _first;
+        _first = chunk;
+    }
+    const auto address = alignAddress(chunk->begin());
+    _current = chunk;
+    _cursor = reinterpret_cast<std::byte *>(address + bytes);
+    _end = chunk->end;
+    return reinterpret_cast<void *>(address);
+}
+
+void Arena::reset(void) noexcept
+{
+    if (!_first)
+        return;
+    _current = _first;
+    _cursor = _first->begin();
+    _end = _first->end;
+}
+
+void Arena::rewind(const Marker marker) noexcept
+{
+    if (!marker.chunk) {
+        reset();
+        return;
+    }
+    _current = reinterpret_cast<Chunk *>(marker.chunk);
+    _cursor = marker.cursor;
+    _end = _current->end;
+}
+
+std::size_t Arena::reservedBytes(void) const noexcept
+{
+    std::size_t bytes = 0u;
+
+    for (auto chunk = _first; chunk; chunk = chunk->next)
+        bytes += static_cast<std::size_t>(chunk->end - chunk->begin());
+    return bytes;
+}
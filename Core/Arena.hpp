@@ -0,0 +1,156 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Monotonic arena allocators
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    class Arena;
+    class FrameArena;
+
+    /** @brief Allocate from the arena of the calling thread, compatible with the Allocated* containers */
+    [[nodiscard]] void *ArenaAlloc(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Arena memory is only released by 'reset' or 'rewind' */
+    inline void ArenaFree(void * const, const std::size_t, const std::size_t) noexcept {}
+
+    /** @brief Allocate from the frame arena of the calling thread, compatible with the Allocated* containers */
+    [[nodiscard]] void *FrameAlloc(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Frame arena memory is released two frames later */
+    inline void FrameFree(void * const, const std::size_t, const std::size_t) noexcept {}
+}
+
+/**
+ * @brief Monotonic bump allocator working on a list of chunks
+ * Deallocation is a no-op, the whole arena is released in O(1) by 'reset' or partially by 'rewind'
+ * Chunks are kept across resets so a warmed-up arena never touches the heap
+ * An arena is not thread safe, use 'Local' to get the arena of the calling thread
+ */
+class Core::Arena
+{
+public:
+    /** @brief Default size of a chunk */
+    static constexpr std::size_t DefaultChunkSize = 64ul * 1024ul;
+
+    /** @brief Position in the arena that can be restored with 'rewind' */
+    struct Marker
+    {
+        void *chunk { nullptr };
+        std::byte *cursor { nullptr };
+    };
+
+    /** @brief Rewinds the arena to its state at construction when destroyed */
+    class Scope
+    {
+    public:
+        /** @brief Mark the arena */
+        Scope(Arena &arena) noexcept : _arena(arena), _marker(arena.mark()) {}
+
+        /** @brief Rewind the arena */
+        ~Scope(void) noexcept { _arena.rewind(_marker); }
+
+    private:
+        Arena &_arena;
+        Marker _marker;
+
+        /** @brief Copy and move constructors disabled */
+        Scope(const Scope &other) = delete;
+        Scope(Scope &&other) = delete;
+    };
+
+    /** @brief Get the arena of the calling thread */
+    [[nodiscard]] static Arena &Local(void) noexcept;
+
+    /** @brief Construct an arena, no memory is allocated until the first allocation */
+    Arena(const std::size_t chunkSize = DefaultChunkSize) noexcept : _chunkSize(chunkSize) {}
+
+    /** @brief Release all chunks */
+    ~Arena(void) noexcept;
+
+    /** @brief Allocate 'bytes' aligned to 'alignment' (power of 2)
+     *  @return nullptr if a new chunk could not be allocated */
+    [[nodiscard]] void *allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        const auto address = (reinterpret_cast<std::uintptr_t>(_cursor) + alignment - 1) & -alignment;
+        if (address + bytes <= reinterpret_cast<std::uintptr_t>(_end)) [[likely]] {
+            _cursor = reinterpret_cast<std::byte *>(address + bytes);
+            return reinterpret_cast<void *>(address);
+        }
+        return allocateSlow(bytes, alignment);
+    }
+
+    /** @brief Release all allocations in O(1), chunks are kept for later use */
+    void reset(void) noexcept;
+
+    /** @brief Get the current position of the arena */
+    [[nodiscard]] Marker mark(void) const noexcept { return Marker { _current, _cursor }; }
+
+    /** @brief Release all allocations made after 'marker' was taken */
+    void rewind(const Marker marker) noexcept;
+
+    /** @brief Get the total number of bytes reserved by the chunks */
+    [[nodiscard]] std::size_t reservedBytes(void) const noexcept;
+
+private:
+    /** @brief Header of a chunk, its memory follows */
+    struct alignas_cacheline Chunk
+    {
+        Chunk *next { nullptr };
+        std::byte *end { nullptr };
+
+        /** @brief Get the first byte of the chunk */
+        [[nodiscard]] std::byte *begin(void) noexcept { return reinterpret_cast<std::byte *>(this + 1); }
+    };
+
+    Chunk *_first { nullptr };
+    Chunk *_current { nullptr };
+    std::byte *_cursor { nullptr };
+    std::byte *_end { nullptr };
+    std::size_t _chunkSize { DefaultChunkSize };
+
+    /** @brief Move to the next chunk able to hold the allocation, allocating it if necessary */
+    [[nodiscard]] void *allocateSlow(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Copy and move constructors disabled */
+    Arena(const Arena &other) = delete;
+    Arena(Arena &&other) = delete;
+};
+
+/**
+ * @brief Double buffered arena, allocations of a frame remain valid during the next frame
+ * Typically used for per audio block scratch memory: call 'nextFrame' at the beginning of each block
+ */
+class Core::FrameArena
+{
+public:
+    /** @brief Get the frame arena of the calling thread */
+    [[nodiscard]] static FrameArena &Local(void) noexcept;
+
+    /** @brief Construct both arenas */
+    FrameArena(const std::size_t chunkSize = Arena::DefaultChunkSize) noexcept : _arenas { Arena(chunkSize), Arena(chunkSize) } {}
+
+    /** @brief Allocate from the arena of the current frame */
+    [[nodiscard]] void *allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) noexcept
+        { return _arenas[_frame & 1].allocate(bytes, alignment); }
+
+    /** @brief Begin a new frame, releasing the allocations of the frame before the current one */
+    void nextFrame(void) noexcept { _arenas[++_frame & 1].reset(); }
+
+    /** @brief Get the arena of the current frame */
+    [[nodiscard]] Arena &current(void) noexcept { return _arenas[_frame & 1]; }
+
+    /** @brief Get the current frame index */
+    [[nodiscard]] std::size_t frame(void) const noexcept { return _frame; }
+
+private:
+    Arena _arenas[2];
+    std::size_t _frame { 0u };
+};
@@ -0,0 +1,124 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Single producer multiple readers broadcast ring buffer
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    struct OverwriteSlowestReader;
+    struct WaitSlowestReader;
+
+    template<typename Type, typename OverrunPolicy = OverwriteSlowestReader>
+    class BroadcastRing;
+}
+
+/** @brief The producer never waits, slow readers lose the overwritten elements */
+struct Core::OverwriteSlowestReader
+{
+    static constexpr bool WaitForReaders = false;
+};
+
+/** @brief The producer fails to push while the slowest reader is a full ring behind */
+struct Core::WaitSlowestReader
+{
+    static constexpr bool WaitForReaders = true;
+};
+
+/**
+ * @brief The broadcast ring is a lock-free ring buffer where every element is seen by all readers
+ * A single producer writes slots protected by a sequence lock, each reader keeps its own cursor
+ * Readers detect overruns through the slot sequence numbers and resume at the oldest available element
+ *
+ * @tparam Type to be broadcasted, must be trivially copyable (usually a block of samples)
+ * @tparam OverrunPolicy Behavior of the producer when the slowest reader is a full ring behind
+ */
+template<typename Type, typename OverrunPolicy>
+class alignas_double_cacheline Core::BroadcastRing
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type>, "Core::BroadcastRing: Type must be trivially copyable");
+
+    /** @brief Identifier of a reader */
+    using ReaderID = std::uint32_t;
+
+    /** @brief A slot is protected by a sequence lock, readers copy it optimistically then validate the copy
+     *  Its sequence is odd while position 'n' is written (2n + 1) and even once it is published (2n + 2) */
+    struct alignas_cacheline Slot
+    {
+        std::atomic<std::uint64_t> sequence { 0u };
+        alignas(Type) std::byte data[sizeof(Type)];
+    };
+
+    /** @brief Reader state, only accessed by its reader thread except the cursor */
+    struct alignas_cacheline Reader
+    {
+        std::atomic<std::uint64_t> cursor { 0u }; // Next position to read
+        std::atomic<bool> subscribed { false };
+        std::uint64_t lostCount { 0u }; // Number of elements lost to overruns
+    };
+
+    /** @brief Default constructor initialize the ring, capacity must be a power of 2 */
+    BroadcastRing(const std::size_t capacity, const std::size_t maxReaders);
+
+    /** @brief Release all memory */
+    ~BroadcastRing(void) noexcept;
+
+    /** @brief Get the capacity of the ring */
+    [[nodiscard]] std::size_t capacity(void) const noexcept { return _mask + 1; }
+
+    /** @brief Register a new reader starting at the next pushed element (any thread)
+     *  @throw std::runtime_error if 'maxReaders' are already subscribed */
+    [[nodiscard]] ReaderID subscribe(void);
+
+    /** @brief Unregister a reader */
+    void unsubscribe(const ReaderID reader) noexcept;
+
+    /** @brief Broadcast an element to every reader (producer only)
+     *  @return false if the slowest reader is a full ring behind, always true when overwriting */
+    [[nodiscard]] bool push(const Type &value) noexcept;
+
+    /** @brief Read the next element of a reader (reader only)
+     *  On overrun the lost elements are skipped and accumulated into the reader's lost count
+     *  @return true if an element has been extracted, otherwise 'value' is unspecified */
+    [[nodiscard]] bool pop(const ReaderID reader, Type &value) noexcept;
+
+    /** @brief Get the number of elements available to a reader */
+    [[nodiscard]] std::size_t size(const ReaderID reader) const noexcept;
+
+    /** @brief Get the number of elements a reader lost to overruns (reader only) */
+    [[nodiscard]] std::uint64_t lostCount(const ReaderID reader) const noexcept { return _readers[reader].lostCount; }
+
+private:
+    alignas_cacheline std::atomic<std::uint64_t> _tail { 0u }; // Next position to write
+    std::uint64_t _minCursor { 0u }; // Cursor of the slowest reader cached by the producer
+    alignas_cacheline Slot *_slots { nullptr };
+    std::uint64_t _mask { 0u };
+    Reader *_readers { nullptr };
+    std::size_t _readerCount { 0u };
+
+    /** @brief Copy and move constructors disabled */
+    BroadcastRing(const BroadcastRing &other) = delete;
+    BroadcastRing(BroadcastRing &&other) = delete;
+
+    /** @brief Copy an element while the producer may overwrite it, the copy is discarded if the slot sequence changed */
+    CORE_NO_SANITIZE_THREAD static void RacyCopy(void * const to, const void * const from) noexcept
+        { std::memcpy(to, from, sizeof(Type)); }
+
+    /** @brief Retrieve the cursor of the slowest reader */
+    [[nodiscard]] std::uint64_t slowestCursor(const std::uint64_t tail) const noexcept;
+};
+
+static_assert_sizeof(Core::BroadcastRing<float>, 2 * Core::CacheLineSize);
+static_assert_alignof_double_cacheline(Core::BroadcastRing<float>);
+
+#include "BroadcastRing.ipp"
@@ -0,0 +1,130 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Single producer multiple readers broadcast ring buffer
+ */
+
+#include <stdexcept>
+
+template<typename Type, typename OverrunPolicy>
+inline Core::BroadcastRing<Type, OverrunPolicy>::BroadcastRing(const std::size_t capacity, const std::size_t maxReaders)
+    : _mask(capacity - 1), _readerCount(maxReaders)
+{
+    if (!((capacity >= 2) && ((capacity & (capacity - 1)) == 0)))
+        throw std::invalid_argument("Core::BroadcastRing: Buffer capacity must be a power of 2");
+    else if (!maxReaders)
+        throw std::invalid_argument("Core::BroadcastRing: Reader count must be > 0");
+    else if (_slots = Utils::AlignedAlloc<alignof(Slot), Slot>(sizeof(Slot) * capacity); !_slots)
+        throw std::runtime_error("Core::BroadcastRing: Malloc failed");
+    else if (_readers = Utils::AlignedAlloc<alignof(Reader), Reader>(sizeof(Reader) * maxReaders); !_readers) {
+        Utils::AlignedFree(_slots);
+        throw std::runtime_error("Core::BroadcastRing: Malloc failed");
+    }
+    for (auto i = 0ul; i < capacity; ++i)
+        new (&_slots[i]) Slot;
+    for (auto i = 0ul; i < maxReaders; ++i)
+        new (&_readers[i]) Reader;
+}
+
+template<typename Type, typename OverrunPolicy>
+inline Core::BroadcastRing<Type, OverrunPolicy>::~BroadcastRing(void) noexcept
+{
+    Utils::AlignedFree(_slots);
+    Utils::AlignedFree(_readers);
+}
+
+template<typename Type, typename OverrunPolicy>
+inline typename Core::BroadcastRing<Type, OverrunPolicy>::ReaderID Core::BroadcastRing<Type, OverrunPolicy>::subscribe(void)
+{
+    for (auto i = 0ul; i < _readerCount; ++i) {
+        auto &reader = _readers[i];
+        bool expected = false;
+        if (!reader.subscribed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+            continue;
+        // The producer may see the previous cursor meanwhile, which is always behind the tail
+        reader.cursor.store(_tail.load(std::memory_order_acquire), std::memory_order_release);
+        reader.lostCount = 0u;
+        return static_cast<ReaderID>(i);
+    }
+    throw std::runtime_error("Core::BroadcastRing: Too many readers");
+}
+
+template<typename Type, typename OverrunPolicy>
+inline void Core::BroadcastRing<Type, OverrunPolicy>::unsubscribe(const ReaderID reader) noexcept
+{
+    _readers[reader].subscribed.store(false, std::memory_order_release);
+}
+
+template<typename Type, typename OverrunPolicy>
+inline bool Core::BroadcastRing<Type, OverrunPolicy>::push(const Type &value) noexcept
+{
+    const auto pos = _tail.load(std::memory_order_relaxed);
+
+    if constexpr (OverrunPolicy::WaitForReaders) {
+        if (pos - _minCursor > _mask) {
+            _minCursor = slowestCursor(pos);
+            if (pos - _minCursor > _mask)
+                return false;
+        }
+    }
+    auto &slot = _slots[pos & _mask];
+    slot.sequence.store(2 * pos + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    RacyCopy(slot.data, &value);
+    slot.sequence.store(2 * pos + 2, std::memory_order_release);
+    _tail.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename Type, typename OverrunPolicy>
+inline bool Core::BroadcastRing<Type, OverrunPolicy>::pop(const ReaderID reader, Type &value) noexcept
+{
+    auto &state = _readers[reader];
+    auto cursor = state.cursor.load(std::memory_order_relaxed);
+
+    while (true) {
+        const auto &slot = _slots[cursor & _mask];
+        const auto expected = 2 * cursor + 2;
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence < expected) // Not published yet
+            return false;
+        else if (sequence == expected) {
+            RacyCopy(&value, slot.data);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == expected)
+                break;
+        }
+        // Overrun, resume at the oldest element which is not being overwritten
+        const auto tail = _tail.load(std::memory_order_acquire);
+        const auto oldest = tail > _mask ? tail - _mask : 0u;
+        if (oldest > cursor) {
+            state.lostCount += oldest - cursor;
+            cursor = oldest;
+        }
+    }
+    state.cursor.store(cursor + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename Type, typename OverrunPolicy>
+inline std::size_t Core::BroadcastRing<Type, OverrunPolicy>::size(const ReaderID reader) const noexcept
+{
+    const auto cursor = _readers[reader].cursor.load(std::memory_order_relaxed);
+    const auto tail = _tail.load(std::memory_order_acquire);
+
+    if (tail <= cursor)
+        return 0u;
+    return std::min<std::size_t>(tail - cursor, _mask + 1);
+}
+
+template<typename Type, typename OverrunPolicy>
+inline std::uint64_t Core::BroadcastRing<Type, OverrunPolicy>::slowestCursor(const std::uint64_t tail) const noexcept
+{
+    auto slowest = tail;
+
+    for (auto i = 0ul; i < _readerCount; ++i) {
+        const auto &reader = _readers[i];
+        if (reader.subscribed.load(std::memory_order_acquire))
+            slowest = std::min(slowest, reader.cursor.load(std::memory_order_acquire));
+    }
+    return slowest;
+}
@@ -0,0 +1,85 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Cell layout policies of the MPMC queue
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    struct PackedCellLayout;
+    struct PaddedCellLayout;
+    struct ScrambledCellLayout;
+}
+
+/** @brief The default layout, cells are packed and consecutive positions use consecutive cells
+ *  Best memory footprint but neighboring cells of small types share cachelines */
+struct Core::PackedCellLayout
+{
+    /** @brief Minimum alignment of a cell */
+    static constexpr std::size_t CellAlignment = 1;
+
+    /** @brief Minimum capacity of the queue */
+    template<std::size_t CellSize>
+    static constexpr std::size_t MinCapacity = 1;
+
+    /** @brief Get the cell index of a queue position */
+    template<std::size_t CellSize>
+    [[nodiscard]] static constexpr std::size_t Index(const std::size_t pos, const std::size_t mask) noexcept
+        { return pos & mask; }
+};
+
+/** @brief Each cell is padded to a full cacheline, no false sharing at the cost of memory */
+struct Core::PaddedCellLayout
+{
+    /** @brief Minimum alignment of a cell */
+    static constexpr std::size_t CellAlignment = CacheLineSize;
+
+    /** @brief Minimum capacity of the queue */
+    template<std::size_t CellSize>
+    static constexpr std::size_t MinCapacity = 1;
+
+    /** @brief Get the cell index of a queue position */
+    template<std::size_t CellSize>
+    [[nodiscard]] static constexpr std::size_t Index(const std::size_t pos, const std::size_t mask) noexcept
+        { return pos & mask; }
+};
+
+/** @brief Cells are packed but consecutive positions are mapped onto different cachelines
+ *  The low bits of the index (cell within a cacheline) are swapped with the following bits (cacheline),
+ *  so the capacity must be at least the square of the number of cells per cacheline */
+struct Core::ScrambledCellLayout
+{
+    /** @brief Minimum alignment of a cell */
+    static constexpr std::size_t CellAlignment = 1;
+
+    /** @brief Number of cells per cacheline, rounded down to a power of 2 */
+    template<std::size_t CellSize>
+    static constexpr std::size_t CellsPerCacheLine = std::bit_floor(std::max<std::size_t>(CacheLineSize / CellSize, 1));
+
+    /** @brief Minimum capacity of the queue */
+    template<std::size_t CellSize>
+    static constexpr std::size_t MinCapacity = CellsPerCacheLine<CellSize> * CellsPerCacheLine<CellSize>;
+
+    /** @brief Get the cell index of a queue position */
+    template<std::size_t CellSize>
+    [[nodiscard]] static constexpr std::size_t Index(const std::size_t pos, const std::size_t mask) noexcept
+    {
+        constexpr auto Bits = static_cast<std::size_t>(std::countr_zero(CellsPerCacheLine<CellSize>));
+        constexpr auto BitsMask = (static_cast<std::size_t>(1) << Bits) - 1;
+        const auto index = pos & mask;
+
+        if constexpr (!Bits)
+            return index;
+        else {
+            const auto mix = (index ^ (index >> Bits)) & BitsMask;
+            return index ^ mix ^ (mix << Bits);
+        }
+    }
+};
@@ -4,33 +4,59 @@ project(Core)
 get_filename_component(CoreDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 
 set(CorePrecompiledHeaders
+    ${CoreDir}/AlignedHeapArray.hpp
+    ${CoreDir}/AllocatedFlatHashMap.hpp
+    ${CoreDir}/AllocatedFlatHashSet.hpp
     ${CoreDir}/AllocatedFlatString.hpp
     ${CoreDir}/AllocatedFlatVector.hpp
     ${CoreDir}/AllocatedSmallString.hpp
     ${CoreDir}/AllocatedSmallVector.hpp
     ${CoreDir}/AllocatedString.hpp
     ${CoreDir}/AllocatedVector.hpp
+    ${CoreDir}/AllocPolicy.hpp
+    ${CoreDir}/Arena.hpp
     ${CoreDir}/Assert.hpp
+    ${CoreDir}/BroadcastRing.hpp
+    ${CoreDir}/CellLayout.hpp
     ${CoreDir}/Dispatcher.hpp
     ${CoreDir}/DispatcherDetails.hpp
+    ${CoreDir}/EytzingerArray.hpp
+    ${CoreDir}/FlatHashMap.hpp
+    ${CoreDir}/FlatHashSet.hpp
+    ${CoreDir}/FlatHashTableDetails.hpp
     ${CoreDir}/FlatString.hpp
     ${CoreDir}/FlatVector.hpp
     ${CoreDir}/Functor.hpp
+    ${CoreDir}/Futex.hpp
+    ${CoreDir}/GrowthPolicy.hpp
     ${CoreDir}/Hash.hpp
     ${CoreDir}/HeapArray.hpp
+    ${CoreDir}/LargeAlloc.hpp
     ${CoreDir}/MPMCQueue.hpp
+    ${CoreDir}/MPSCQueue.hpp
     ${CoreDir}/PMR.hpp
+    ${CoreDir}/PoolResource.hpp
+    ${CoreDir}/QueueStats.hpp
+    ${CoreDir}/Scheduler.hpp
     ${CoreDir}/SmallString.hpp
     ${CoreDir}/SmallVector.hpp
+    ${CoreDir}/SoAVector.hpp
+    ${CoreDir}/SoAVectorDetails.hpp
     ${CoreDir}/SortedAllocatedFlatVector.hpp
     ${CoreDir}/SortedAllocatedSmallVector.hpp
     ${CoreDir}/SortedAllocatedVector.hpp
+    ${CoreDir}/SortedFlatMap.hpp
+    ${CoreDir}/SortedFlatMapDetails.hpp
     ${CoreDir}/SortedFlatVector.hpp
+    ${CoreDir}/SortedFlatVectorMap.hpp
+    ${CoreDir}/SortedSmallFlatMap.hpp
     ${CoreDir}/SortedSmallVector.hpp
     ${CoreDir}/SortedVector.hpp
     ${CoreDir}/SortedVectorDetails.hpp
     ${CoreDir}/SPSCQueue.hpp
+    ${CoreDir}/SPSCUnboundedQueue.hpp
     ${CoreDir}/String.hpp
+    ${CoreDir}/StringAlgorithms.hpp
     ${CoreDir}/StringDetails.hpp
     ${CoreDir}/StringLiteral.hpp
     ${CoreDir}/TrivialDispatcher.hpp
@@ -40,26 +66,46 @@ set(CorePrecompiledHeaders
     ${CoreDir}/Utils.hpp
     ${CoreDir}/Vector.hpp
     ${CoreDir}/VectorDetails.hpp
+    ${CoreDir}/WaitPolicy.hpp
+    ${CoreDir}/WorkStealingDeque.hpp
 )
 
 set(CoreSources
     ${CorePrecompiledHeaders}
+    ${CoreDir}/AllocatedFlatHashTableBase.hpp
     ${CoreDir}/AllocatedFlatVectorBase.hpp
     ${CoreDir}/AllocatedSmallVectorBase.hpp
     ${CoreDir}/AllocatedVectorBase.hpp
+    ${CoreDir}/FlatHashTableBase.hpp
     ${CoreDir}/FlatVectorBase.hpp
     ${CoreDir}/SmallVectorBase.hpp
     ${CoreDir}/VectorBase.hpp
+    ${CoreDir}/AlignedHeapArray.ipp
+    ${CoreDir}/Arena.cpp
+    ${CoreDir}/BroadcastRing.ipp
     ${CoreDir}/Core.cpp
+    ${CoreDir}/EytzingerArray.ipp
+    ${CoreDir}/FlatHashTableDetails.ipp
     ${CoreDir}/FlatVectorBase.ipp
+    ${CoreDir}/Futex.cpp
     ${CoreDir}/HeapArray.ipp
+    ${CoreDir}/LargeAlloc.cpp
     ${CoreDir}/MPMCQueue.ipp
+    ${CoreDir}/MPSCQueue.ipp
+    ${CoreDir}/PoolResource.cpp
+    ${CoreDir}/Scheduler.cpp
     ${CoreDir}/SmallVectorBase.ipp
+    ${CoreDir}/SoAVectorDetails.ipp
+    ${CoreDir}/SortedFlatMapDetails.ipp
     ${CoreDir}/SortedVectorDetails.ipp
     ${CoreDir}/SPSCQueue.ipp
+    ${CoreDir}/SPSCUnboundedQueue.ipp
+    ${CoreDir}/StringAlgorithms.cpp
     ${CoreDir}/Utils.ipp
     ${CoreDir}/VectorBase.ipp
     ${CoreDir}/VectorDetails.ipp
+    ${CoreDir}/WaitPolicy.ipp
+    ${CoreDir}/WorkStealingDeque.ipp
 )
 
 add_library(${PROJECT_NAME} ${CoreSources})
@@ -0,0 +1,131 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Read-only sorted array stored in Eytzinger (breadth-first) order
+ */
+
+#pragma once
+
+#include <bit>
+#include <functional>
+#include <stdexcept>
+
+#include "Assert.hpp"
+#include "Utils.hpp"
+
+namespace Core
+{
+    template<typename Type, typename Compare = std::less<Type>>
+    class EytzingerArray;
+}
+
+/**
+ * @brief Read-only snapshot of a sorted range, stored in the breadth-first order of its implicit search tree
+ *  A lookup walks the tree from the root: the first levels share the same cachelines, and the descendants
+ *  a few levels below are contiguous so they are prefetched in a single cacheline while comparing.
+ *  It outperforms binary search on large lookup-heavy sets, but must be rebuilt when the source changes.
+ *
+ * @tparam Type Type of element
+ * @tparam Compare Compare operator, the source range must be sorted with it
+ */
+template<typename Type, typename Compare>
+class Core::EytzingerArray
+{
+public:
+    /** @brief Default construct an empty array */
+    EytzingerArray(void) noexcept = default;
+
+    /** @brief Build the array from a sorted range */
+    template<typename InputIterator>
+    EytzingerArray(InputIterator from, InputIterator to) noexcept(nothrow_ndebug && nothrow_forward_iterator_constructible(InputIterator))
+        { build(from, to); }
+
+    /** @brief Build the array from a sorted container */
+    template<typename Container, typename = decltype(std::begin(std::declval<const Container &>()))>
+    explicit EytzingerArray(const Container &container) noexcept(nothrow_ndebug && nothrow_copy_constructible(Type))
+        { build(std::begin(container), std::end(container)); }
+
+    /** @brief Copy constructor */
+    EytzingerArray(const EytzingerArray &other) noexcept(nothrow_ndebug && nothrow_copy_constructible(Type));
+
+    /** @brief Move constructor */
+    EytzingerArray(EytzingerArray &&other) noexcept { swap(other); }
+
+    /** @brief Destruct the array and all elements */
+    ~EytzingerArray(void) noexcept_destructible(Type) { release(); }
+
+    /** @brief Copy assignment */
+    EytzingerArray &operator=(const EytzingerArray &other) noexcept(nothrow_ndebug && nothrow_copy_constructible(Type))
+        { if (this != &other) { EytzingerArray tmp(other); swap(tmp); } return *this; }
+
+    /** @brief Move assignment */
+    EytzingerArray &operator=(EytzingerArray &&other) noexcept { swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(EytzingerArray &other) noexcept { std::swap(_data, other._data); std::swap(_size, other._size); }
+
+
+    /** @brief Rebuild the array from a sorted range */
+    template<typename InputIterator>
+    void build(InputIterator from, InputIterator to) noexcept(nothrow_ndebug && nothrow_forward_iterator_constructible(InputIterator));
+
+    /** @brief Destroy all elements and release memory */
+    void release(void) noexcept_destructible(Type);
+
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Get the number of elements */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _size; }
+
+
+    /** @brief Find the first element (in sorted order) not ordered before 'value'
+     *  @return nullptr if every element is ordered before 'value' */
+    template<typename Comparable>
+    [[nodiscard]] const Type *lowerBound(const Comparable &value) const noexcept_invocable(Compare, const Type &, const Comparable &)
+        { return at(search([&value](const Type &other) { return Compare{}(other, value); })); }
+
+    /** @brief Find the first element (in sorted order) ordered after 'value'
+     *  @return nullptr if no element is ordered after 'value' */
+    template<typename Comparable>
+    [[nodiscard]] const Type *upperBound(const Comparable &value) const noexcept_invocable(Compare, const Comparable &, const Type &)
+        { return at(search([&value](const Type &other) { return !Compare{}(value, other); })); }
+
+    /** @brief Find an element equivalent to 'value'
+     *  @return nullptr if not found */
+    template<typename Comparable>
+    [[nodiscard]] const Type *find(const Comparable &value) const
+        noexcept(nothrow_invocable(Compare, const Type &, const Comparable &) && nothrow_invocable(Compare, const Comparable &, const Type &))
+        { const auto elem = lowerBound(value); return elem && !Compare{}(value, *elem) ? elem : nullptr; }
+
+    /** @brief Check if the array contains an element equivalent to 'value' */
+    template<typename Comparable>
+    [[nodiscard]] bool contains(const Comparable &value) const
+        noexcept(nothrow_invocable(Compare, const Type &, const Comparable &) && nothrow_invocable(Compare, const Comparable &, const Type &))
+        { return find(value) != nullptr; }
+
+
+    /** @brief Get the elements in Eytzinger order */
+    [[nodiscard]] const Type *data(void) const noexcept { return _data ? _data + 1 : nullptr; }
+
+private:
+    /** @brief 1-based storage, the children of 'i' are '2i' and '2i + 1' */
+    Type *_data { nullptr };
+    std::size_t _size { 0 };
+
+    /** @brief Number of elements sharing a cacheline, prefetched 'log2(BlockSize)' levels ahead */
+    static constexpr std::size_t BlockSize = CacheLineSize / sizeof(Type) ? CacheLineSize / sizeof(Type) : 1ul;
+
+    /** @brief Walk the tree, returning the 1-based index of the first element not matching 'isBefore', 0 if none */
+    template<typename Predicate>
+    [[nodiscard]] std::size_t search(Predicate &&isBefore) const noexcept(nothrow_invocable(Predicate, const Type &));
+
+    /** @brief Get an element by 1-based index, nullptr for 0 */
+    [[nodiscard]] const Type *at(const std::size_t index) const noexcept { return index ? _data + index : nullptr; }
+
+    /** @brief Fill the tree in-order from a sorted range */
+    template<typename InputIterator>
+    void fill(InputIterator &it, const std::size_t index) noexcept_forward_iterator_constructible(InputIterator);
+};
+
+#include "EytzingerArray.ipp"
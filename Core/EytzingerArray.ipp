@@ -0,0 +1,73 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Read-only sorted array stored in Eytzinger (breadth-first) order
+ */
+
+template<typename Type, typename Compare>
+inline Core::EytzingerArray<Type, Compare>::EytzingerArray(const EytzingerArray &other) noexcept(nothrow_ndebug && nothrow_copy_constructible(Type))
+{
+    if (!other._size)
+        return;
+    _data = Utils::AlignedAlloc<CacheLineSize, Type>(sizeof(Type) * (other._size + 1ul));
+    coreAssert(_data,
+        throw std::runtime_error("Core::EytzingerArray: Malloc failed"));
+    _size = other._size;
+    for (auto i = 1ul; i <= _size; ++i)
+        new (_data + i) Type(other._data[i]);
+}
+
+template<typename Type, typename Compare>
+template<typename InputIterator>
+inline void Core::EytzingerArray<Type, Compare>::build(InputIterator from, InputIterator to)
+    noexcept(nothrow_ndebug && nothrow_forward_iterator_constructible(InputIterator))
+{
+    release();
+    const auto count = static_cast<std::size_t>(std::distance(from, to));
+    if (!count)
+        return;
+    // The element 0 is never constructed, it aligns the blocks of descendants on cachelines
+    _data = Utils::AlignedAlloc<CacheLineSize, Type>(sizeof(Type) * (count + 1ul));
+    coreAssert(_data,
+        throw std::runtime_error("Core::EytzingerArray::build: Malloc failed"));
+    _size = count;
+    fill(from, 1ul);
+}
+
+template<typename Type, typename Compare>
+inline void Core::EytzingerArray<Type, Compare>::release(void) noexcept_destructible(Type)
+{
+    if (!_data)
+        return;
+    std::destroy(_data + 1, _data + _size + 1);
+    Utils::AlignedFree(_data);
+    _data = nullptr;
+    _size = 0ul;
+}
+
+template<typename Type, typename Compare>
+template<typename Predicate>
+inline std::size_t Core::EytzingerArray<Type, Compare>::search(Predicate &&isBefore) const noexcept(nothrow_invocable(Predicate, const Type &))
+{
+    auto index = 1ul;
+
+    while (index <= _size) {
+        // Computed on integers as the descendants may be past the end of the array
+        Utils::Prefetch(reinterpret_cast<const void *>(reinterpret_cast<std::uintptr_t>(_data) + index * BlockSize * sizeof(Type)));
+        index = 2ul * index + static_cast<std::size_t>(isBefore(_data[index]));
+    }
+    // Drop the right turns taken after the last left turn, its node is the answer
+    return index >> (std::countr_one(index) + 1);
+}
+
+template<typename Type, typename Compare>
+template<typename InputIterator>
+inline void Core::EytzingerArray<Type, Compare>::fill(InputIterator &it, const std::size_t index)
+    noexcept_forward_iterator_constructible(InputIterator)
+{
+    if (index > _size)
+        return;
+    fill(it, 2ul * index);
+    new (_data + index) Type(*it);
+    ++it;
+    fill(it, 2ul * index + 1ul);
+}
@@ -0,0 +1,24 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flat hash map
+ */
+
+#pragma once
+
+#include "FlatHashTableDetails.hpp"
+#include "FlatHashTableBase.hpp"
+
+namespace Core
+{
+    /**
+     * @brief Open addressing hash map storing its pairs contiguously
+     *  Lookups are heterogeneous: a map of String can be searched with a std::string_view or a cstring
+     *
+     * @tparam Key Key type
+     * @tparam Value Mapped type
+     * @tparam KeyHasher Transparent hash functor
+     * @tparam KeyCompare Transparent equality functor
+     */
+    template<typename Key, typename Value, typename KeyHasher = Hasher, typename KeyCompare = KeyEqual>
+    using FlatHashMap = Internal::FlatHashTableDetails<Internal::FlatHashTableBase, Key, Value, KeyHasher, KeyCompare>;
+}
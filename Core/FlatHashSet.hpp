@@ -0,0 +1,23 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Flat hash set
+ */
+
+#pragma once
+
+#include "FlatHashTableDetails.hpp"
+#include "FlatHashTableBase.hpp"
+
+namespace Core
+{
+    /**
+     * @brief Open addressing hash set storing its keys contiguously
+     *  Lookups are heterogeneous: a set of String can be searched with a std::string_view or a cstring
+     *
+     * @tparam Key Key type
+     * @tparam KeyHasher Transparent hash functor
+     * @tparam KeyCompare Transparent equality functor
+     */
+    template<typename Key, typename KeyHasher = Hasher, typename KeyCompare = KeyEqual>
+    using FlatHashSet = Internal::FlatHashTableDetails<Internal::FlatHashTableBase, Key, void, KeyHasher, KeyCompare>;
+}
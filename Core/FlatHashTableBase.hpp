@@ -0,0 +1,26 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Base allocation of a flat hash table
+ */
+
+#pragma once
+
+#include "Utils.hpp"
+
+namespace Core::Internal
+{
+    class FlatHashTableBase;
+}
+
+/** @brief Allocate the table through the aligned heap */
+class Core::Internal::FlatHashTableBase
+{
+protected:
+    /** @brief Allocates a new table */
+    [[nodiscard]] void *allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { return Utils::AlignedAlloc(bytes, alignment); }
+
+    /** @brief Deallocates a table */
+    void deallocate(void * const data, const std::size_t, const std::size_t) noexcept
+        { Utils::AlignedFree(data); }
+};
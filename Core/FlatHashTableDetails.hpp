@@ -0,0 +1,382 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Open addressing hash table with control bytes probed by groups
+ */
+
+#pragma once
+
+#include <bit>
+#include <stdexcept>
+#include <tuple>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+# include <emmintrin.h>
+#endif
+
+#include "Assert.hpp"
+#include "Hash.hpp"
+#include "Utils.hpp"
+
+namespace Core::Internal
+{
+    /** @brief Control byte of a slot: a negative value for empty, deleted or the sentinel, the 7 low bits of the hash for a full slot */
+    using HashControl = std::int8_t;
+
+    struct HashGroup;
+
+    template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+    class FlatHashTableDetails;
+}
+
+/** @brief Group of control bytes probed at once */
+struct Core::Internal::HashGroup
+{
+    /** @brief Number of control bytes in a group */
+    static constexpr std::size_t Size = 16ul;
+
+    /** @brief Special control bytes */
+    static constexpr HashControl Empty = -128;
+    static constexpr HashControl Deleted = -2;
+    static constexpr HashControl Sentinel = -1;
+
+    /** @brief Bit 'i' is set when the control byte 'i' of the group matched */
+    using Mask = std::uint32_t;
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    /** @brief Load a group from any control byte */
+    explicit HashGroup(const HashControl * const controls) noexcept
+        : _controls(_mm_loadu_si128(reinterpret_cast<const __m128i *>(controls))) {}
+
+    /** @brief Full slots having the same hash bits */
+    [[nodiscard]] Mask match(const HashControl hash) const noexcept
+        { return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(_controls, _mm_set1_epi8(hash)))); }
+
+    /** @brief Empty slots */
+    [[nodiscard]] Mask matchEmpty(void) const noexcept
+        { return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(_controls, _mm_set1_epi8(Empty)))); }
+
+    /** @brief Empty or deleted slots, the sentinel is excluded */
+    [[nodiscard]] Mask matchEmptyOrDeleted(void) const noexcept
+        { return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(Sentinel), _controls))); }
+
+private:
+    __m128i _controls;
+#else
+    /** @brief Load a group from any control byte */
+    explicit HashGroup(const HashControl * const controls) noexcept
+        { std::memcpy(_controls, controls, Size); }
+
+    /** @brief Full slots having the same hash bits */
+    [[nodiscard]] Mask match(const HashControl hash) const noexcept
+        { return matchIf([hash](const HashControl control) { return control == hash; }); }
+
+    /** @brief Empty slots */
+    [[nodiscard]] Mask matchEmpty(void) const noexcept
+        { return matchIf([](const HashControl control) { return control == Empty; }); }
+
+    /** @brief Empty or deleted slots, the sentinel is excluded */
+    [[nodiscard]] Mask matchEmptyOrDeleted(void) const noexcept
+        { return matchIf([](const HashControl control) { return control < Sentinel; }); }
+
+private:
+    HashControl _controls[Size];
+
+    /** @brief Build a mask out of a predicate */
+    template<typename Predicate>
+    [[nodiscard]] Mask matchIf(Predicate &&predicate) const noexcept
+    {
+        Mask mask = 0u;
+        for (auto i = 0ul; i < Size; ++i)
+            mask |= static_cast<Mask>(predicate(_controls[i])) << i;
+        return mask;
+    }
+#endif
+};
+
+/**
+ * @brief Open addressing hash table storing its slots contiguously (SwissTable layout)
+ *  Each slot has a control byte, groups of control bytes are matched at once with SIMD instructions
+ *  Slots never move unless the table is rehashed: erasing while iterating is safe
+ *
+ * @tparam Base Allocation base of the table
+ * @tparam Key Key type
+ * @tparam Value Mapped type, void for a set
+ * @tparam Hasher Transparent hash functor
+ * @tparam Equal Transparent equality functor, called with a stored key and a lookup key
+ */
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+class Core::Internal::FlatHashTableDetails : protected Base
+{
+public:
+    /** @brief Tell if the table maps keys to values */
+    static constexpr bool IsMap = !std::is_void_v<Value>;
+
+    /** @brief Stored type, iterators only expose the key of a map slot as constant */
+    using Slot = std::conditional_t<IsMap, std::pair<Key, Value>, Key>;
+
+    /** @brief Forward iterator over full slots */
+    template<bool IsConst>
+    class IteratorBase
+    {
+    public:
+        /** @brief Slot pointer of the iterator */
+        using SlotPointer = std::conditional_t<IsConst, const Slot *, Slot *>;
+
+        /** @brief Pair of references to the key and the value of a map slot, the key can't be modified */
+        struct MapReference
+        {
+            const Key &first;
+            std::conditional_t<IsConst, const Value, Value> &second;
+
+            /** @brief Arrow operator to support 'it->first' */
+            [[nodiscard]] const MapReference *operator->(void) const noexcept { return this; }
+        };
+
+        /** @brief Iterator traits */
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::conditional_t<IsMap, MapReference, Key>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsMap, MapReference, const Key *>;
+        using reference = std::conditional_t<IsMap, MapReference, const Key &>;
+
+        /** @brief Default constructor */
+        IteratorBase(void) noexcept = default;
+
+        /** @brief Construct an iterator and move it to the next full slot */
+        IteratorBase(const HashControl * const control, const SlotPointer slot) noexcept
+            : _control(control), _slot(slot) { if (_control) skipEmpty(); }
+
+        /** @brief Conversion to a constant iterator */
+        operator IteratorBase<true>(void) const noexcept { return IteratorBase<true>(_control, _slot); }
+
+        /** @brief Access operators */
+        [[nodiscard]] reference operator*(void) const noexcept
+        {
+            if constexpr (IsMap)
+                return MapReference { _slot->first, _slot->second };
+            else
+                return *_slot;
+        }
+        [[nodiscard]] pointer operator->(void) const noexcept
+        {
+            if constexpr (IsMap)
+                return **this;
+            else
+                return _slot;
+        }
+
+        /** @brief Increment operators */
+        IteratorBase &operator++(void) noexcept { ++_control; ++_slot; skipEmpty(); return *this; }
+        IteratorBase operator++(int) noexcept { auto tmp = *this; ++*this; return tmp; }
+
+        /** @brief Comparison operators */
+        [[nodiscard]] bool operator==(const IteratorBase &other) const noexcept { return _control == other._control; }
+        [[nodiscard]] bool operator!=(const IteratorBase &other) const noexcept { return _control != other._control; }
+
+    private:
+        const HashControl *_control { nullptr };
+        SlotPointer _slot { nullptr };
+
+        /** @brief Skip empty and deleted slots, stops on the sentinel */
+        void skipEmpty(void) noexcept
+        {
+            while (*_control < HashGroup::Sentinel) {
+                ++_control;
+                ++_slot;
+            }
+        }
+
+        friend FlatHashTableDetails;
+    };
+
+    /** @brief Iterators, the keys are constant */
+    using Iterator = IteratorBase<!IsMap>;
+    using ConstIterator = IteratorBase<true>;
+
+
+    /** @brief Default constructor */
+    FlatHashTableDetails(void) noexcept = default;
+
+    /** @brief Copy constructor */
+    FlatHashTableDetails(const FlatHashTableDetails &other) noexcept_copy_constructible(Slot) { copy(other); }
+
+    /** @brief Move constructor */
+    FlatHashTableDetails(FlatHashTableDetails &&other) noexcept { steal(other); }
+
+    /** @brief Initializer list constructor */
+    FlatHashTableDetails(std::initializer_list<Slot> &&init) noexcept_copy_constructible(Slot);
+
+    /** @brief Release the table */
+    ~FlatHashTableDetails(void) noexcept_destructible(Slot) { release(); }
+
+    /** @brief Copy assignment */
+    FlatHashTableDetails &operator=(const FlatHashTableDetails &other) noexcept_copy_constructible(Slot);
+
+    /** @brief Move assignment */
+    FlatHashTableDetails &operator=(FlatHashTableDetails &&other) noexcept_destructible(Slot) { release(); steal(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(FlatHashTableDetails &other) noexcept;
+
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Get the number of elements */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _size; }
+
+    /** @brief Get the number of slots */
+    [[nodiscard]] std::size_t capacity(void) const noexcept { return _capacity; }
+
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] Iterator begin(void) noexcept { return Iterator(_controls, _slots); }
+    [[nodiscard]] Iterator end(void) noexcept { return Iterator(_controls + _capacity, _slots + _capacity); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return ConstIterator(_controls, _slots); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return ConstIterator(_controls + _capacity, _slots + _capacity); }
+
+
+    /** @brief Find an element using any key type supported by Hasher and Equal
+     *  @return end() if the key is not found */
+    template<typename Lookup>
+    [[nodiscard]] Iterator find(const Lookup &key) noexcept
+        { const auto index = findIndex(key, Hasher()(key)); return Iterator(_controls + index, _slots + index); }
+    template<typename Lookup>
+    [[nodiscard]] ConstIterator find(const Lookup &key) const noexcept
+        { const auto index = findIndex(key, Hasher()(key)); return ConstIterator(_controls + index, _slots + index); }
+
+    /** @brief Check if the table contains a key */
+    template<typename Lookup>
+    [[nodiscard]] bool contains(const Lookup &key) const noexcept { return findIndex(key, Hasher()(key)) != _capacity; }
+
+
+    /** @brief Insert a key if not present, the key is only constructed from 'key' on insertion
+     *  For a map, the value is constructed from 'args'
+     *  @return The iterator to the element and true if it was inserted */
+    template<typename KeyArg, typename ...Args>
+    std::pair<Iterator, bool> tryEmplace(KeyArg &&key, Args &&...args)
+        noexcept(nothrow_constructible(Key, KeyArg) && (!IsMap || nothrow_constructible(Value, Args...)));
+
+    /** @brief Insert a slot if its key is not present */
+    std::pair<Iterator, bool> insert(const Slot &slot) noexcept_copy_constructible(Slot);
+    std::pair<Iterator, bool> insert(Slot &&slot) noexcept_move_constructible(Slot);
+
+    /** @brief Insert or assign the value of a key (map only) */
+    template<typename KeyArg, typename ValueArg, typename Mapped = Value>
+    std::pair<Iterator, bool> insertOrAssign(KeyArg &&key, ValueArg &&value)
+        noexcept(nothrow_constructible(Key, KeyArg) && nothrow_constructible(Mapped, ValueArg) && nothrow_forward_assignable(ValueArg));
+
+    /** @brief Access the value of a key, inserting a default constructed value if not present (map only) */
+    template<typename KeyArg, typename Mapped = Value>
+    [[nodiscard]] Mapped &operator[](KeyArg &&key)
+        noexcept(nothrow_constructible(Key, KeyArg) && nothrow_default_constructible(Mapped))
+        { return tryEmplace(std::forward<KeyArg>(key)).first->second; }
+
+    /** @brief Access the value of an existing key (map only) */
+    template<typename Lookup, typename Mapped = Value>
+    [[nodiscard]] Mapped &at(const Lookup &key) noexcept_ndebug;
+    template<typename Lookup, typename Mapped = Value>
+    [[nodiscard]] const Mapped &at(const Lookup &key) const noexcept_ndebug;
+
+
+    /** @brief Erase a key
+     *  @return True if the key was found */
+    template<typename Lookup>
+    std::enable_if_t<!std::is_convertible_v<const Lookup &, ConstIterator>, bool> erase(const Lookup &key) noexcept_destructible(Slot);
+
+    /** @brief Erase the element of a valid iterator, other iterators stay valid */
+    void erase(const ConstIterator pos) noexcept_destructible(Slot)
+        { eraseIndex(static_cast<std::size_t>(pos._control - _controls)); }
+
+
+    /** @brief Reserve the slots required to insert 'count' elements without rehashing */
+    void reserve(const std::size_t count) noexcept(nothrow_destructible(Slot) && (IsTriviallyRelocatable<Slot>::Value || nothrow_move_constructible(Slot)));
+
+    /** @brief Destroy all elements, keeping the table */
+    void clear(void) noexcept_destructible(Slot);
+
+    /** @brief Destroy all elements and release the table */
+    void release(void) noexcept_destructible(Slot);
+
+private:
+    HashControl *_controls { nullptr };
+    Slot *_slots { nullptr };
+    std::size_t _size { 0ul };
+    std::size_t _capacity { 0ul };
+    std::size_t _growthLeft { 0ul };
+
+    /** @brief Control bytes mirrored after the sentinel so a group can be loaded from any slot */
+    static constexpr std::size_t ClonedControls = HashGroup::Size - 1ul;
+
+    /** @brief Smallest capacity, a group never reads past the mirrored control bytes */
+    static constexpr std::size_t MinCapacity = HashGroup::Size - 1ul;
+
+    /** @brief Alignment of the table */
+    static constexpr std::size_t Alignment = alignof(Slot) > HashGroup::Size ? alignof(Slot) : HashGroup::Size;
+
+    /** @brief Get the key of a slot */
+    [[nodiscard]] static const Key &KeyOf(const Slot &slot) noexcept
+    {
+        if constexpr (IsMap)
+            return slot.first;
+        else
+            return slot;
+    }
+
+    /** @brief Position part of a hash */
+    [[nodiscard]] static std::size_t HashPosition(const HashedName hash) noexcept { return static_cast<std::size_t>(hash >> 7); }
+
+    /** @brief Control part of a hash */
+    [[nodiscard]] static HashControl HashBits(const HashedName hash) noexcept { return static_cast<HashControl>(hash & 0x7F); }
+
+    /** @brief Maximum number of elements of a capacity (load factor of 7/8) */
+    [[nodiscard]] static std::size_t CapacityToGrowth(const std::size_t capacity) noexcept { return capacity - capacity / 8ul; }
+
+    /** @brief Smallest capacity able to hold 'count' elements */
+    [[nodiscard]] static std::size_t NormalizeCapacity(const std::size_t count) noexcept;
+
+    /** @brief Byte offset of the slots in the table */
+    [[nodiscard]] static std::size_t SlotsOffset(const std::size_t capacity) noexcept
+        { return (capacity + HashGroup::Size + alignof(Slot) - 1ul) & ~(alignof(Slot) - 1ul); }
+
+    /** @brief Byte size of the table */
+    [[nodiscard]] static std::size_t AllocationSize(const std::size_t capacity) noexcept
+        { return SlotsOffset(capacity) + capacity * sizeof(Slot); }
+
+
+    /** @brief Find the slot index of a key, _capacity if not found */
+    template<typename Lookup>
+    [[nodiscard]] std::size_t findIndex(const Lookup &key, const HashedName hash) const noexcept;
+
+    /** @brief Find the first empty or deleted slot of a hash */
+    [[nodiscard]] std::size_t findInsertIndex(const HashedName hash) const noexcept;
+
+    /** @brief Find a slot for a new element of a hash, growing the table if required
+     *  The slot is only claimed by 'commitInsert', once the element is constructed */
+    [[nodiscard]] std::size_t prepareInsert(const HashedName hash)
+        noexcept(nothrow_destructible(Slot) && (IsTriviallyRelocatable<Slot>::Value || nothrow_move_constructible(Slot)));
+
+    /** @brief Claim a slot returned by 'prepareInsert' after its element has been constructed */
+    void commitInsert(const std::size_t index, const HashedName hash) noexcept;
+
+    /** @brief Set a control byte and its mirror */
+    void setControl(const std::size_t index, const HashControl control) noexcept;
+
+    /** @brief Erase the element at index */
+    void eraseIndex(const std::size_t index) noexcept_destructible(Slot);
+
+    /** @brief Move every element to a new table of 'capacity' slots */
+    void rehash(const std::size_t capacity)
+        noexcept(nothrow_destructible(Slot) && (IsTriviallyRelocatable<Slot>::Value || nothrow_move_constructible(Slot)));
+
+    /** @brief Allocate an empty table, keeping the current size */
+    void allocateTable(const std::size_t capacity) noexcept;
+
+    /** @brief Copy another table, slots keep their indexes */
+    void copy(const FlatHashTableDetails &other) noexcept_copy_constructible(Slot);
+
+    /** @brief Steal another table */
+    void steal(FlatHashTableDetails &other) noexcept;
+};
+
+#include "FlatHashTableDetails.ipp"
@@ -0,0 +1,331 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Open addressing hash table with control bytes probed by groups
+ */
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::FlatHashTableDetails(std::initializer_list<Slot> &&init)
+    noexcept_copy_constructible(Slot)
+{
+    reserve(init.size());
+    for (const auto &slot : init)
+        insert(slot);
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal> &
+    Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::operator=(const FlatHashTableDetails &other) noexcept_copy_constructible(Slot)
+{
+    if (this != &other) {
+        release();
+        copy(other);
+    }
+    return *this;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::swap(FlatHashTableDetails &other) noexcept
+{
+    std::swap(_controls, other._controls);
+    std::swap(_slots, other._slots);
+    std::swap(_size, other._size);
+    std::swap(_capacity, other._capacity);
+    std::swap(_growthLeft, other._growthLeft);
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+template<typename KeyArg, typename ...Args>
+inline std::pair<typename Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::Iterator, bool>
+    Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::tryEmplace(KeyArg &&key, Args &&...args)
+        noexcept(nothrow_constructible(Key, KeyArg) && (!IsMap || nothrow_constructible(Value, Args...)))
+{
+    const auto hash = Hasher()(key);
+
+    if (const auto index = findIndex(key, hash); index != _capacity)
+        return std::make_pair(Iterator(_controls + index, _slots + index), false);
+    const auto index = prepareInsert(hash);
+    // The slot is claimed only once constructed, so a throwing constructor leaves the table untouched
+    if constexpr (IsMap) {
+        new (_slots + index) Slot(std::piecewise_construct,
+            std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+    } else
+        new (_slots + index) Slot(std::forward<KeyArg>(key));
+    commitInsert(index, hash);
+    return std::make_pair(Iterator(_controls + index, _slots + index), true);
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline std::pair<typename Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::Iterator, bool>
+    Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::insert(const Slot &slot) noexcept_copy_constructible(Slot)
+{
+    if constexpr (IsMap)
+        return tryEmplace(slot.first, slot.second);
+    else
+        return tryEmplace(slot);
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline std::pair<typename Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::Iterator, bool>
+    Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::insert(Slot &&slot) noexcept_move_constructible(Slot)
+{
+    if constexpr (IsMap)
+        return tryEmplace(std::move(slot.first), std::move(slot.second));
+    else
+        return tryEmplace(std::move(slot));
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+template<typename KeyArg, typename ValueArg, typename Mapped>
+inline std::pair<typename Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::Iterator, bool>
+    Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::insertOrAssign(KeyArg &&key, ValueArg &&value)
+        noexcept(nothrow_constructible(Key, KeyArg) && nothrow_constructible(Mapped, ValueArg) && nothrow_forward_assignable(ValueArg))
+{
+    const auto hash = Hasher()(key);
+
+    if (const auto index = findIndex(key, hash); index != _capacity) {
+        _slots[index].second = std::forward<ValueArg>(value);
+        return std::make_pair(Iterator(_controls + index, _slots + index), false);
+    }
+    const auto index = prepareInsert(hash);
+    new (_slots + index) Slot(std::forward<KeyArg>(key), std::forward<ValueArg>(value));
+    commitInsert(index, hash);
+    return std::make_pair(Iterator(_controls + index, _slots + index), true);
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+template<typename Lookup, typename Mapped>
+inline Mapped &Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::at(const Lookup &key) noexcept_ndebug
+{
+    const auto index = findIndex(key, Hasher()(key));
+
+    coreAssert(index != _capacity,
+        throw std::out_of_range("Core::FlatHashMap::at: Key not found"));
+    return _slots[index].second;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+template<typename Lookup, typename Mapped>
+inline const Mapped &Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::at(const Lookup &key) const noexcept_ndebug
+{
+    const auto index = findIndex(key, Hasher()(key));
+
+    coreAssert(index != _capacity,
+        throw std::out_of_range("Core::FlatHashMap::at: Key not found"));
+    return _slots[index].second;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+template<typename Lookup>
+inline std::enable_if_t<!std::is_convertible_v<const Lookup &, typename Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::ConstIterator>, bool>
+    Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::erase(const Lookup &key) noexcept_destructible(Slot)
+{
+    const auto index = findIndex(key, Hasher()(key));
+
+    if (index == _capacity)
+        return false;
+    eraseIndex(index);
+    return true;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::reserve(const std::size_t count)
+    noexcept(nothrow_destructible(Slot) && (IsTriviallyRelocatable<Slot>::Value || nothrow_move_constructible(Slot)))
+{
+    if (count > _size + _growthLeft)
+        rehash(NormalizeCapacity(count));
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::clear(void) noexcept_destructible(Slot)
+{
+    if (!_capacity)
+        return;
+    if constexpr (!std::is_trivially_destructible_v<Slot>) {
+        for (auto i = 0ul; i < _capacity; ++i) {
+            if (_controls[i] >= 0)
+                std::destroy_at(_slots + i);
+        }
+    }
+    std::memset(_controls, HashGroup::Empty, _capacity + HashGroup::Size);
+    _controls[_capacity] = HashGroup::Sentinel;
+    _size = 0ul;
+    _growthLeft = CapacityToGrowth(_capacity);
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::release(void) noexcept_destructible(Slot)
+{
+    if (!_capacity)
+        return;
+    if constexpr (!std::is_trivially_destructible_v<Slot>) {
+        for (auto i = 0ul; i < _capacity; ++i) {
+            if (_controls[i] >= 0)
+                std::destroy_at(_slots + i);
+        }
+    }
+    Base::deallocate(_controls, AllocationSize(_capacity), Alignment);
+    _controls = nullptr;
+    _slots = nullptr;
+    _size = 0ul;
+    _capacity = 0ul;
+    _growthLeft = 0ul;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline std::size_t Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::NormalizeCapacity(const std::size_t count) noexcept
+{
+    auto capacity = MinCapacity;
+
+    while (CapacityToGrowth(capacity) < count)
+        capacity = capacity * 2ul + 1ul;
+    return capacity;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+template<typename Lookup>
+inline std::size_t Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::findIndex(const Lookup &key, const HashedName hash) const noexcept
+{
+    if (!_capacity) [[unlikely]]
+        return 0ul;
+    const auto bits = HashBits(hash);
+    auto offset = HashPosition(hash) & _capacity;
+
+    // Triangular probing over groups visits every group of a power of 2 table
+    for (auto step = HashGroup::Size; ; step += HashGroup::Size) {
+        const HashGroup group(_controls + offset);
+        for (auto mask = group.match(bits); mask; mask &= mask - 1u) {
+            const auto index = (offset + static_cast<std::size_t>(std::countr_zero(mask))) & _capacity;
+            if (Equal()(KeyOf(_slots[index]), key)) [[likely]]
+                return index;
+        }
+        if (group.matchEmpty()) [[likely]]
+            return _capacity;
+        offset = (offset + step) & _capacity;
+    }
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline std::size_t Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::findInsertIndex(const HashedName hash) const noexcept
+{
+    auto offset = HashPosition(hash) & _capacity;
+
+    for (auto step = HashGroup::Size; ; step += HashGroup::Size) {
+        if (const auto mask = HashGroup(_controls + offset).matchEmptyOrDeleted(); mask) [[likely]]
+            return (offset + static_cast<std::size_t>(std::countr_zero(mask))) & _capacity;
+        offset = (offset + step) & _capacity;
+    }
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline std::size_t Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::prepareInsert(const HashedName hash)
+    noexcept(nothrow_destructible(Slot) && (IsTriviallyRelocatable<Slot>::Value || nothrow_move_constructible(Slot)))
+{
+    if (!_capacity) [[unlikely]]
+        rehash(MinCapacity);
+    auto index = findInsertIndex(hash);
+    // Reusing a deleted slot doesn't consume growth
+    if (!_growthLeft && _controls[index] != HashGroup::Deleted) [[unlikely]] {
+        // Tables mostly filled with deleted slots are cleaned up instead of growing
+        if (_capacity > HashGroup::Size && _size * 32ul <= _capacity * 25ul)
+            rehash(_capacity);
+        else
+            rehash(_capacity * 2ul + 1ul);
+        index = findInsertIndex(hash);
+    }
+    return index;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::commitInsert(const std::size_t index, const HashedName hash) noexcept
+{
+    _growthLeft -= _controls[index] == HashGroup::Empty;
+    setControl(index, HashBits(hash));
+    ++_size;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::setControl(const std::size_t index, const HashControl control) noexcept
+{
+    _controls[index] = control;
+    _controls[((index - ClonedControls) & _capacity) + (ClonedControls & _capacity)] = control;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::eraseIndex(const std::size_t index) noexcept_destructible(Slot)
+{
+    const auto before = (index - HashGroup::Size) & _capacity;
+    const auto emptyAfter = HashGroup(_controls + index).matchEmpty();
+    const auto emptyBefore = HashGroup(_controls + before).matchEmpty();
+    // If every group containing the slot also contains an empty slot, no probe sequence ever went past it
+    const bool wasNeverFull = emptyBefore && emptyAfter
+        && static_cast<std::size_t>(std::countr_zero(emptyAfter) + std::countl_zero(static_cast<std::uint16_t>(emptyBefore))) < HashGroup::Size;
+
+    std::destroy_at(_slots + index);
+    setControl(index, wasNeverFull ? HashGroup::Empty : HashGroup::Deleted);
+    _growthLeft += wasNeverFull;
+    --_size;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::rehash(const std::size_t capacity)
+    noexcept(nothrow_destructible(Slot) && (IsTriviallyRelocatable<Slot>::Value || nothrow_move_constructible(Slot)))
+{
+    const auto oldControls = _controls;
+    const auto oldSlots = _slots;
+    const auto oldCapacity = _capacity;
+
+    allocateTable(capacity);
+    for (auto i = 0ul; i < oldCapacity; ++i) {
+        if (oldControls[i] < 0)
+            continue;
+        const auto hash = Hasher()(KeyOf(oldSlots[i]));
+        const auto index = findInsertIndex(hash);
+        setControl(index, HashBits(hash));
+        Utils::RelocateN(oldSlots + i, 1ul, _slots + index);
+    }
+    if (oldCapacity)
+        Base::deallocate(oldControls, AllocationSize(oldCapacity), Alignment);
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::allocateTable(const std::size_t capacity) noexcept
+{
+    const auto data = reinterpret_cast<std::byte *>(Base::allocate(AllocationSize(capacity), Alignment));
+
+    _controls = reinterpret_cast<HashControl *>(data);
+    _slots = reinterpret_cast<Slot *>(data + SlotsOffset(capacity));
+    _capacity = capacity;
+    _growthLeft = CapacityToGrowth(capacity) - _size;
+    std::memset(_controls, HashGroup::Empty, capacity + HashGroup::Size);
+    _controls[capacity] = HashGroup::Sentinel;
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::copy(const FlatHashTableDetails &other) noexcept_copy_constructible(Slot)
+{
+    if (!other._capacity)
+        return;
+    _size = other._size;
+    allocateTable(other._capacity);
+    _growthLeft = other._growthLeft;
+    std::memcpy(_controls, other._controls, _capacity + HashGroup::Size);
+    for (auto i = 0ul; i < _capacity; ++i) {
+        if (_controls[i] >= 0)
+            new (_slots + i) Slot(other._slots[i]);
+    }
+}
+
+template<typename Base, typename Key, typename Value, typename Hasher, typename Equal>
+inline void Core::Internal::FlatHashTableDetails<Base, Key, Value, Hasher, Equal>::steal(FlatHashTableDetails &other) noexcept
+{
+    _controls = other._controls;
+    _slots = other._slots;
+    _size = other._size;
+    _capacity = other._capacity;
+    _growthLeft = other._growthLeft;
+    other._controls = nullptr;
+    other._slots = nullptr;
+    other._size = 0ul;
+    other._capacity = 0ul;
+    other._growthLeft = 0ul;
+}
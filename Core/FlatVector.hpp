@@ -15,11 +15,12 @@ namespace Core
      *
      * @tparam Type Internal type in container
      * @tparam Range Range of container
+     * @tparam GrowthPolicy Policy computing the capacity when the vector runs out of memory
      */
-    template<typename Type, typename Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using FlatVector = Internal::VectorDetails<Internal::FlatVectorBase<Type, Range, CustomHeaderType>, Type, Range>;
+    template<typename Type, typename Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType, typename GrowthPolicy = DoubleGrowthPolicy>
+    using FlatVector = Internal::VectorDetails<Internal::FlatVectorBase<Type, Range, CustomHeaderType>, Type, Range, false, GrowthPolicy>;
 
     /** @brief 8 bytes vector using signed char with a reduced range */
-    template<typename Type, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using TinyFlatVector = Internal::VectorDetails<Internal::FlatVectorBase<Type, std::uint32_t, CustomHeaderType>, Type, std::uint32_t>;
+    template<typename Type, typename CustomHeaderType = Internal::NoCustomHeaderType, typename GrowthPolicy = DoubleGrowthPolicy>
+    using TinyFlatVector = FlatVector<Type, std::uint32_t, CustomHeaderType, GrowthPolicy>;
 }
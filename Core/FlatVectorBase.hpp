@@ -114,7 +114,7 @@ public:
 
 protected:
     /** @brief Protected data setter */
-    void setData(Type * const data) noexcept { _ptr = reinterpret_cast<Header *>(data) - 1; }
+    void setData(Type * const data) noexcept { _ptr = data ? reinterpret_cast<Header *>(data) - 1 : nullptr; }
 
     /** @brief Protected size setter */
     void setSize(const Range size) noexcept { _ptr->size = size; }
@@ -145,6 +145,25 @@ protected:
         Utils::AlignedFree(ptr);
     }
 
+    /** @brief Allocates a temporary buffer, used by algorithms requiring scratch memory */
+    [[nodiscard]] static Type *allocateScratch(const Range count) noexcept
+        { return reinterpret_cast<Type *>(Utils::AlignedAlloc<alignof(Type)>(sizeof(Type) * count)); }
+
+    /** @brief Deallocates a temporary buffer */
+    static void deallocateScratch(Type * const data, const Range) noexcept { Utils::AlignedFree(data); }
+
+    /** @brief Resizes a buffer and its header in place if possible, elements are copied bytewise
+     *  @return nullptr if the buffer can't be reallocated, 'data' is then left untouched */
+    [[nodiscard]] Type *reallocate(Type * const data, const Range, const Range capacity) noexcept
+    {
+        if constexpr (!std::is_same_v<CustomHeaderType, NoCustomHeaderType> && !IsTriviallyRelocatable<CustomHeaderType>::Value)
+            return nullptr;
+        else {
+            auto ptr = reinterpret_cast<Header *>(Utils::AlignedRealloc(reinterpret_cast<Header *>(data) - 1, sizeof(Header) + sizeof(Type) * capacity, alignof(Header)));
+            return ptr ? reinterpret_cast<Type *>(ptr + 1) : nullptr;
+        }
+    }
+
 private:
     Header *_ptr { nullptr };
 };
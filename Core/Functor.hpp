@@ -200,4 +200,11 @@ private:
         if (_destruct)
             _destruct(_cache);
     }
-};
\ No newline at end of file
+};
+
+/** @brief The cache of a functor only holds trivial functors or a pointer to the heap */
+template<typename Return, typename ...Args, std::size_t CacheSize>
+struct Core::IsTriviallyRelocatable<Core::Functor<Return(Args...), CacheSize>>
+{
+    static constexpr bool Value = true;
+};
@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Futex helpers
+ */
+
+#include "Futex.hpp"
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <climits>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <time.h>
+
+namespace
+{
+    inline long Futex(std::atomic<std::uint32_t> &word, const int op, const std::uint32_t value, const timespec *timeout) noexcept
+    {
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "Futex word must be a plain 32 bits integer");
+
+        return syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), op | FUTEX_PRIVATE_FLAG, value, timeout, nullptr, 0);
+    }
+}
+
+void Core::Utils::FutexWait(std::atomic<std::uint32_t> &word, const std::uint32_t expected) noexcept
+{
+    Futex(word, FUTEX_WAIT, expected, nullptr);
+}
+
+bool Core::Utils::FutexWaitFor(std::atomic<std::uint32_t> &word, const std::uint32_t expected, const std::chrono::nanoseconds timeout) noexcept
+{
+    if (timeout.count() <= 0)
+        return word.load(std::memory_order_relaxed) != expected;
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    const timespec time {
+        static_cast<time_t>(seconds.count()),
+        static_cast<long>((timeout - seconds).count())
+    };
+    return Futex(word, FUTEX_WAIT, expected, &time) == 0 || errno != ETIMEDOUT;
+}
+
+void Core::Utils::FutexWakeOne(std::atomic<std::uint32_t> &word) noexcept
+{
+    Futex(word, FUTEX_WAKE, 1, nullptr);
+}
+
+void Core::Utils::FutexWakeAll(std::atomic<std::uint32_t> &word) noexcept
+{
+    Futex(word, FUTEX_WAKE, INT_MAX, nullptr);
+}
+
+#else
+
+#include <thread>
+
+void Core::Utils::FutexWait(std::atomic<std::uint32_t> &word, const std::uint32_t expected) noexcept
+{
+    word.wait(expected, std::memory_order_relaxed);
+}
+
+bool Core::Utils::FutexWaitFor(std::atomic<std::uint32_t> &word, const std::uint32_t expected, const std::chrono::nanoseconds timeout) noexcept
+{
+    // std::atomic::wait has no timed overload, poll the word until the deadline
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (word.load(std::memory_order_relaxed) == expected) {
+        if (std::chrono::steady_clock::now() >= deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    return true;
+}
+
+void Core::Utils::FutexWakeOne(std::atomic<std::uint32_t> &word) noexcept
+{
+    word.notify_one();
+}
+
+void Core::Utils::FutexWakeAll(std::atomic<std::uint32_t> &word) noexcept
+{
+    word.notify_all();
+}
+
+#endif
@@ -0,0 +1,40 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Futex helpers used to park threads on a 32 bits atomic word
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+# include <immintrin.h>
+#endif
+
+namespace Core::Utils
+{
+    /** @brief Block the calling thread while 'word' is equal to 'expected' (spurious wake-ups are allowed) */
+    void FutexWait(std::atomic<std::uint32_t> &word, const std::uint32_t expected) noexcept;
+
+    /** @brief Block the calling thread while 'word' is equal to 'expected', for at most 'timeout'
+     *  @return false if the timeout expired */
+    [[nodiscard]] bool FutexWaitFor(std::atomic<std::uint32_t> &word, const std::uint32_t expected, const std::chrono::nanoseconds timeout) noexcept;
+
+    /** @brief Wake one thread blocked on 'word' */
+    void FutexWakeOne(std::atomic<std::uint32_t> &word) noexcept;
+
+    /** @brief Wake all threads blocked on 'word' */
+    void FutexWakeAll(std::atomic<std::uint32_t> &word) noexcept;
+
+    /** @brief Hint the processor that the calling thread is spinning */
+    inline void CpuRelax(void) noexcept
+    {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+#endif
+    }
+}
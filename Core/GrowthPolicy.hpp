@@ -0,0 +1,77 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Growth policies of the vectors
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace Core
+{
+    template<std::size_t Numerator, std::size_t Denominator>
+    struct FactorGrowthPolicy;
+
+    template<std::size_t PageSize = 4096ul>
+    struct PageGrowthPolicy;
+
+    template<std::size_t Step>
+    struct StepGrowthPolicy;
+
+    /** @brief Double the capacity (default) */
+    using DoubleGrowthPolicy = FactorGrowthPolicy<2ul, 1ul>;
+
+    /** @brief Grow the capacity by 50%, trading more reallocations for less unused memory */
+    using HalfGrowthPolicy = FactorGrowthPolicy<3ul, 2ul>;
+}
+
+/**
+ * @brief Multiply the capacity by 'Numerator / Denominator'
+ * A growth policy computes the capacity of a vector running out of memory,
+ * the result must be greater than 'capacity + minimum' and than 'capacity'
+ */
+template<std::size_t Numerator, std::size_t Denominator>
+struct Core::FactorGrowthPolicy
+{
+    static_assert(Numerator > Denominator && Denominator, "Core::FactorGrowthPolicy: Factor must be greater than 1");
+
+    /** @brief Get the next capacity of a vector growing of at least 'minimum' elements */
+    template<typename Type, typename Range>
+    [[nodiscard]] static constexpr Range NextCapacity(const Range capacity, const Range minimum) noexcept
+    {
+        const auto growth = static_cast<Range>(capacity * (Numerator - Denominator) / Denominator);
+        return static_cast<Range>(capacity + std::max({ growth, minimum, static_cast<Range>(1) }));
+    }
+};
+
+/** @brief Double the capacity while the buffer is smaller than a page,
+ *  then grow it by 50% rounded up to a multiple of 'PageSize' so no allocated byte is left unused */
+template<std::size_t PageSize>
+struct Core::PageGrowthPolicy
+{
+    static_assert(PageSize && !(PageSize & (PageSize - 1)), "Core::PageGrowthPolicy: PageSize must be a power of 2");
+
+    /** @brief Get the next capacity of a vector growing of at least 'minimum' elements */
+    template<typename Type, typename Range>
+    [[nodiscard]] static constexpr Range NextCapacity(const Range capacity, const Range minimum) noexcept
+    {
+        if (sizeof(Type) * capacity * 2 < PageSize)
+            return DoubleGrowthPolicy::NextCapacity<Type, Range>(capacity, minimum);
+        const auto desired = static_cast<std::size_t>(HalfGrowthPolicy::NextCapacity<Type, Range>(capacity, minimum));
+        const auto bytes = (desired * sizeof(Type) + PageSize - 1) & ~(PageSize - 1);
+        return static_cast<Range>(bytes / sizeof(Type));
+    }
+};
+
+/** @brief Grow the capacity by a fixed amount of elements, useful for vectors with a predictable growth */
+template<std::size_t Step>
+struct Core::StepGrowthPolicy
+{
+    static_assert(Step, "Core::StepGrowthPolicy: Step must be > 0");
+
+    /** @brief Get the next capacity of a vector growing of at least 'minimum' elements */
+    template<typename Type, typename Range>
+    [[nodiscard]] static constexpr Range NextCapacity(const Range capacity, const Range minimum) noexcept
+        { return static_cast<Range>(capacity + std::max(static_cast<Range>(Step), minimum)); }
+};
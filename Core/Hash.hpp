@@ -5,35 +5,296 @@
 
 #pragma once
 
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <string_view>
+#include <type_traits>
+
+#include "Utils.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+# include <immintrin.h>
+#endif
 
 namespace Core
 {
     /** @brief The result type of the hash function */
-    using HashedName = std::uint32_t;
+    using HashedName = std::uint64_t;
 
-    /** @brief The hash offset */
-    constexpr HashedName HashOffset = 4294967291u;
+    /** @brief The default hash seed */
+    constexpr HashedName HashSeed = 0x243F6A8885A308D3ull;
 
-    /** @brief Compile-time string hashing */
-    constexpr HashedName Hash(char const *str, std::size_t len) noexcept {
-        HashedName h = HashOffset;
-        for (std::size_t i = 0ul; i < len; ++i)
-            h = 31u * h + static_cast<HashedName>(str[i]);
-        return h;
-    }
+    /** @brief Compile-time string hashing
+     *  At runtime, the input is read 8 bytes per step and long inputs are accumulated with SIMD instructions,
+     *  the result is the same at compile-time and at runtime */
+    [[nodiscard]] constexpr HashedName Hash(const char * const str, const std::size_t len, const HashedName seed = HashSeed) noexcept;
 
     /** @brief Compile-time char hashing */
-    constexpr HashedName Hash(const char c) noexcept { return 31u * HashOffset + static_cast<HashedName>(c); }
+    [[nodiscard]] constexpr HashedName Hash(const char c) noexcept { return Hash(&c, 1ul); }
 
     /** @brief Compile-time string-view hashing */
-    constexpr HashedName Hash(const std::string_view &str) { return Hash(str.data(), str.length()); }
+    [[nodiscard]] constexpr HashedName Hash(const std::string_view &str) noexcept { return Hash(str.data(), str.length()); }
+
+    /** @brief Compile-time integer hashing, a single multiplication folding the 128 bits product */
+    [[nodiscard]] constexpr HashedName HashInteger(const std::uint64_t value) noexcept;
+
+    /** @brief Transparent hash functor of the hash containers
+     *  Strings (std or Core, views and cstrings) hash their characters so any of them can be used to lookup another
+     *  Integers, enums and pointers (including HashedName keys) are mixed with HashInteger */
+    struct Hasher;
+
+    /** @brief Transparent equality functor of the hash containers */
+    struct KeyEqual;
 
     namespace Literal
     {
         /** @brief Compile-time string hashing literal */
         constexpr HashedName operator ""_hash(char const *str, std::size_t len) { return Hash(str, len); }
+    }
+}
+
+/** @brief Details of the hash function, a wyhash construction for short inputs and a XXH3 like stripes accumulation for long ones */
+namespace Core::Internal::HashDetails
+{
+    /** @brief Secret used to key the hash */
+    constexpr std::uint64_t Secret[16] = {
+        0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull,
+        0x1d8e4e27c47d124full, 0xbe4ba423396cfeb8ull, 0xdb979083e96dd4deull, 0x7c01812cf721ad1cull,
+        0x1f67b3b7a4a44072ull, 0x78e5c0cc4ee679cbull, 0xc8dba0e3ba31e0b9ull, 0x2b16be587de82e8aull,
+        0x81dadef4bc2f0a63ull, 0xd75d5a14d5e91f47ull, 0x3d9c3e77a9b26c15ull, 0x4a7e5f1b29e0d8a3ull
+    };
+
+    /** @brief Inputs longer than this are accumulated by stripes */
+    constexpr std::size_t LongThreshold = 256ul;
+
+    /** @brief Size of a stripe, 8 lanes of 8 bytes */
+    constexpr std::size_t StripeSize = 64ul;
+
+    /** @brief Number of lanes of a stripe */
+    constexpr std::size_t LaneCount = 8ul;
+
+    /** @brief Number of stripes between two scrambles of the accumulators */
+    constexpr std::size_t BlockStripes = 8ul;
+
+    /** @brief Multiplier of the accumulators scramble */
+    constexpr std::uint64_t ScramblePrime = 0x9E3779B1ull;
 
-        static_assert(""_hash == HashOffset, "There is an error in compile-time hashing algorithm");
+    /** @brief Read 8 little endian bytes */
+    [[nodiscard]] constexpr std::uint64_t Read64(const char * const data) noexcept
+    {
+        if (!std::is_constant_evaluated() && std::endian::native == std::endian::little) {
+            std::uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+        std::uint64_t value = 0ull;
+        for (auto i = 0ul; i < sizeof(value); ++i)
+            value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[i])) << (8ul * i);
+        return value;
+    }
+
+    /** @brief Read 4 little endian bytes */
+    [[nodiscard]] constexpr std::uint64_t Read32(const char * const data) noexcept
+    {
+        if (!std::is_constant_evaluated() && std::endian::native == std::endian::little) {
+            std::uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+        std::uint64_t value = 0ull;
+        for (auto i = 0ul; i < sizeof(std::uint32_t); ++i)
+            value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[i])) << (8ul * i);
+        return value;
+    }
+
+    /** @brief Read 1 to 3 bytes */
+    [[nodiscard]] constexpr std::uint64_t Read3(const char * const data, const std::size_t len) noexcept
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[0])) << 16)
+            | (static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[len >> 1])) << 8)
+            | static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[len - 1]));
     }
+
+    /** @brief Full 64 x 64 bits multiplication, lhs receives the low part and rhs the high part */
+    constexpr void Multiply(std::uint64_t &lhs, std::uint64_t &rhs) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using UInt128 = unsigned __int128;
+        const auto product = static_cast<UInt128>(lhs) * rhs;
+        lhs = static_cast<std::uint64_t>(product);
+        rhs = static_cast<std::uint64_t>(product >> 64);
+#else
+        const auto lhsHigh = lhs >> 32, lhsLow = lhs & 0xFFFFFFFFull;
+        const auto rhsHigh = rhs >> 32, rhsLow = rhs & 0xFFFFFFFFull;
+        const auto high = lhsHigh * rhsHigh, middle0 = lhsHigh * rhsLow, middle1 = lhsLow * rhsHigh, low = lhsLow * rhsLow;
+        const auto carry = (low >> 32) + (middle0 & 0xFFFFFFFFull) + (middle1 & 0xFFFFFFFFull);
+        lhs = low + (middle0 << 32) + (middle1 << 32);
+        rhs = high + (middle0 >> 32) + (middle1 >> 32) + (carry >> 32);
+#endif
+    }
+
+    /** @brief Fold the 128 bits product of two words */
+    [[nodiscard]] constexpr std::uint64_t Mix(std::uint64_t lhs, std::uint64_t rhs) noexcept
+    {
+        Multiply(lhs, rhs);
+        return lhs ^ rhs;
+    }
+
+    /** @brief Accumulate a stripe, each lane is independent so the SIMD versions give the same result */
+    constexpr void Accumulate(std::uint64_t (&accumulators)[LaneCount], const char * const data, const std::uint64_t * const key) noexcept
+    {
+        if (!std::is_constant_evaluated()) {
+#if defined(__AVX2__)
+            for (auto i = 0ul; i < LaneCount; i += 4ul) {
+                auto * const accumulator = reinterpret_cast<__m256i *>(accumulators + i);
+                const auto value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i * sizeof(std::uint64_t)));
+                const auto keyed = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(key + i)));
+                const auto product = _mm256_mul_epu32(keyed, _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+                const auto swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+                _mm256_storeu_si256(accumulator, _mm256_add_epi64(_mm256_loadu_si256(accumulator), _mm256_add_epi64(product, swapped)));
+            }
+            return;
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+            for (auto i = 0ul; i < LaneCount; i += 2ul) {
+                auto * const accumulator = reinterpret_cast<__m128i *>(accumulators + i);
+                const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i * sizeof(std::uint64_t)));
+                const auto keyed = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i *>(key + i)));
+                const auto product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+                const auto swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+                _mm_storeu_si128(accumulator, _mm_add_epi64(_mm_loadu_si128(accumulator), _mm_add_epi64(product, swapped)));
+            }
+            return;
+#endif
+        }
+        for (auto i = 0ul; i < LaneCount; ++i) {
+            const auto value = Read64(data + i * sizeof(std::uint64_t));
+            const auto keyed = value ^ key[i];
+            accumulators[i ^ 1ul] += value;
+            accumulators[i] += (keyed & 0xFFFFFFFFull) * (keyed >> 32);
+        }
+    }
+
+    /** @brief Scramble the accumulators so high bits are carried back to the low bits read by the multiplications */
+    constexpr void Scramble(std::uint64_t (&accumulators)[LaneCount], const std::uint64_t * const key) noexcept
+    {
+        for (auto i = 0ul; i < LaneCount; ++i) {
+            const auto value = accumulators[i] ^ (accumulators[i] >> 47) ^ key[i];
+            accumulators[i] = value * ScramblePrime;
+        }
+    }
+
+    /** @brief Hash inputs longer than LongThreshold */
+    [[nodiscard]] constexpr std::uint64_t HashLong(const char * const data, const std::size_t len, const std::uint64_t seed) noexcept
+    {
+        std::uint64_t accumulators[LaneCount] {};
+        // The last stripe is always read from the end of the input
+        const auto stripes = (len - 1ul) / StripeSize;
+
+        for (auto i = 0ul; i < LaneCount; ++i)
+            accumulators[i] = Secret[i] ^ seed;
+        for (auto stripe = 0ul; stripe < stripes; ++stripe) {
+            const auto index = stripe % BlockStripes;
+            Accumulate(accumulators, data + stripe * StripeSize, Secret + index);
+            if (index == BlockStripes - 1ul)
+                Scramble(accumulators, Secret + LaneCount);
+        }
+        Accumulate(accumulators, data + len - StripeSize, Secret + BlockStripes - 1ul);
+        auto result = seed ^ (len * 0x9E3779B97F4A7C15ull);
+        for (auto i = 0ul; i < LaneCount; i += 2ul)
+            result += Mix(accumulators[i] ^ Secret[LaneCount + i], accumulators[i + 1] ^ Secret[LaneCount + i + 1]);
+        return Mix(result ^ Secret[0], seed ^ Secret[1]);
+    }
+}
+
+constexpr Core::HashedName Core::Hash(const char * const str, const std::size_t len, const HashedName seed) noexcept
+{
+    using namespace Internal::HashDetails;
+
+    auto data = str;
+    auto state = seed ^ Mix(seed ^ Secret[0], Secret[1]);
+    std::uint64_t lhs, rhs;
+
+    if (len <= 16ul) {
+        if (len >= 4ul) {
+            const auto offset = (len >> 3) << 2;
+            lhs = (Read32(data) << 32) | Read32(data + offset);
+            rhs = (Read32(data + len - 4ul) << 32) | Read32(data + len - 4ul - offset);
+        } else if (len) {
+            lhs = Read3(data, len);
+            rhs = 0ull;
+        } else
+            lhs = rhs = 0ull;
+    } else if (len <= LongThreshold) {
+        auto remaining = len;
+        if (remaining > 48ul) {
+            // Three independent lanes of 16 bytes
+            auto state1 = state, state2 = state;
+            do {
+                state = Mix(Read64(data) ^ Secret[1], Read64(data + 8) ^ state);
+                state1 = Mix(Read64(data + 16) ^ Secret[2], Read64(data + 24) ^ state1);
+                state2 = Mix(Read64(data + 32) ^ Secret[3], Read64(data + 40) ^ state2);
+                data += 48;
+                remaining -= 48ul;
+            } while (remaining > 48ul);
+            state ^= state1 ^ state2;
+        }
+        while (remaining > 16ul) {
+            state = Mix(Read64(data) ^ Secret[1], Read64(data + 8) ^ state);
+            data += 16;
+            remaining -= 16ul;
+        }
+        lhs = Read64(data + remaining - 16ul);
+        rhs = Read64(data + remaining - 8ul);
+    } else
+        return HashLong(str, len, state);
+    lhs ^= Secret[1];
+    rhs ^= state;
+    Multiply(lhs, rhs);
+    return Mix(lhs ^ Secret[0] ^ len, rhs ^ Secret[1]);
+}
+
+constexpr Core::HashedName Core::HashInteger(const std::uint64_t value) noexcept
+{
+    using namespace Internal::HashDetails;
+
+    return Mix(value ^ Secret[0], Secret[1]);
+}
+
+struct Core::Hasher
+{
+    /** @brief Detect a Core string */
+    template<typename Type>
+    using StdViewDetector = decltype(std::declval<const Type &>().toStdView());
+
+    /** @brief Hash any supported key */
+    template<typename Type>
+    [[nodiscard]] constexpr HashedName operator()(const Type &value) const noexcept
+    {
+        if constexpr (std::is_convertible_v<const Type &, std::string_view>)
+            return Hash(std::string_view(value));
+        else if constexpr (Utils::IsDetected<StdViewDetector, Type>)
+            return Hash(value.toStdView());
+        else if constexpr (std::is_integral_v<Type> || std::is_enum_v<Type>)
+            return HashInteger(static_cast<std::uint64_t>(value));
+        else if constexpr (std::is_pointer_v<Type>)
+            return HashInteger(reinterpret_cast<std::uintptr_t>(value));
+        else
+            return HashInteger(std::hash<Type>()(value));
+    }
+};
+
+struct Core::KeyEqual
+{
+    /** @brief Compare a stored key to a lookup key */
+    template<typename Key, typename Lookup>
+    [[nodiscard]] constexpr bool operator()(const Key &key, const Lookup &lookup) const noexcept
+        { return key == lookup; }
+};
+
+namespace Core::Literal
+{
+    static_assert(""_hash == Hash(std::string_view()), "There is an error in compile-time hashing algorithm");
+    static_assert("a"_hash != "b"_hash && "ab"_hash != "ba"_hash, "There is an error in compile-time hashing algorithm");
 }
@@ -8,16 +8,23 @@
 #include <memory>
 #include <stdexcept>
 
+#include "AllocPolicy.hpp"
 #include "Assert.hpp"
 #include "Utils.hpp"
 
 namespace Core
 {
-    template<typename Type>
+    template<typename Type, typename AllocPolicy = DefaultAllocPolicy>
     class HeapArray;
 }
 
-template<typename Type>
+/**
+ * @brief Runtime sized array
+ *
+ * @tparam Type Type of element
+ * @tparam AllocPolicy Policy allocating the array, LargeAllocPolicy backs large arrays with huge pages
+ */
+template<typename Type, typename AllocPolicy>
 class alignas_quarter_cacheline Core::HeapArray
 {
 public:
@@ -0,0 +1,152 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Huge page and NUMA aware allocation of large buffers
+ */
+
+#include "LargeAlloc.hpp"
+#include "Utils.hpp"
+
+namespace
+{
+    constexpr std::size_t DefaultHugePageSize = 2ul * 1024ul * 1024ul;
+}
+
+#if defined(__linux__)
+
+#include <cstdio>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    /** @brief Prefer the given node for the pages of a mapping (values of <numaif.h>, not always installed) */
+    constexpr int MPolPreferred = 1;
+
+    /** @brief Query the huge page size from /proc/meminfo */
+    [[nodiscard]] std::size_t QueryHugePageSize(void) noexcept
+    {
+        std::size_t size = 0ul;
+
+        if (const auto file = std::fopen("/proc/meminfo", "r"); file) {
+            char line[128];
+            while (std::fgets(line, sizeof(line), file)) {
+                unsigned long kiloBytes = 0ul;
+                if (std::sscanf(line, "Hugepagesize: %lu kB", &kiloBytes) == 1) {
+                    size = kiloBytes * 1024ul;
+                    break;
+                }
+            }
+            std::fclose(file);
+        }
+        return size ? size : DefaultHugePageSize;
+    }
+
+    /** @brief Get the size of a mapping, rounded to huge pages */
+    [[nodiscard]] inline std::size_t MappingSize(const std::size_t bytes) noexcept
+    {
+        const auto pageSize = Core::Utils::HugePageSize();
+
+        return (bytes + pageSize - 1) & -pageSize;
+    }
+
+    /** @brief Check if an allocation goes through a mapping */
+    [[nodiscard]] inline bool IsMapped(const std::size_t bytes, const std::size_t alignment) noexcept
+    {
+        const auto pageSize = Core::Utils::HugePageSize();
+
+        return bytes >= pageSize && alignment <= pageSize;
+    }
+
+    /** @brief Map 'size' bytes aligned to huge pages, preferring explicit huge pages */
+    [[nodiscard]] void *MapHugePages(const std::size_t size) noexcept
+    {
+        constexpr int Protection = PROT_READ | PROT_WRITE;
+        constexpr int Flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#if defined(MAP_HUGETLB)
+        if (const auto data = ::mmap(nullptr, size, Protection, Flags | MAP_HUGETLB, -1, 0); data != MAP_FAILED)
+            return data;
+#endif
+        // Over-map to align the region on a huge page, so it can be backed by transparent huge pages
+        const auto pageSize = Core::Utils::HugePageSize();
+        const auto data = ::mmap(nullptr, size + pageSize, Protection, Flags, -1, 0);
+        if (data == MAP_FAILED)
+            return nullptr;
+        const auto address = reinterpret_cast<std::uintptr_t>(data);
+        const auto aligned = (address + pageSize - 1) & -pageSize;
+        if (const auto head = aligned - address; head)
+            ::munmap(data, head);
+        if (const auto tail = pageSize - (aligned - address); tail)
+            ::munmap(reinterpret_cast<void *>(aligned + size), tail);
+#if defined(MADV_HUGEPAGE)
+        ::madvise(reinterpret_cast<void *>(aligned), size, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    /** @brief Prefer the NUMA node of the calling thread for the pages of a mapping, before they are touched */
+    void BindToLocalNode(void * const data, const std::size_t size) noexcept
+    {
+#if defined(SYS_mbind) && defined(SYS_getcpu)
+        unsigned int cpu = 0u;
+        unsigned int node = 0u;
+        if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 || node >= sizeof(unsigned long) * 8)
+            return;
+        const unsigned long nodeMask = 1ul << node;
+        // Failure is not an issue (no NUMA support), the kernel default policy is used instead
+        ::syscall(SYS_mbind, data, size, MPolPreferred, &nodeMask, sizeof(nodeMask) * 8, 0u);
+#else
+        UNUSED(data);
+        UNUSED(size);
+#endif
+    }
+}
+
+std::size_t Core::Utils::HugePageSize(void) noexcept
+{
+    static const std::size_t Size = QueryHugePageSize();
+
+    return Size;
+}
+
+void *Core::Utils::LargeAlloc(const std::size_t bytes, const std::size_t alignment, const bool bindToLocalNode) noexcept
+{
+    if (!IsMapped(bytes, alignment))
+        return AlignedAlloc(bytes, alignment);
+    const auto size = MappingSize(bytes);
+    const auto data = MapHugePages(size);
+    if (data && bindToLocalNode)
+        BindToLocalNode(data, size);
+    return data;
+}
+
+void Core::Utils::LargeFree(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    if (!data)
+        return;
+    else if (!IsMapped(bytes, alignment))
+        AlignedFree(data);
+    else
+        ::munmap(data, MappingSize(bytes));
+}
+
+#else
+
+std::size_t Core::Utils::HugePageSize(void) noexcept
+{
+    return DefaultHugePageSize;
+}
+
+void *Core::Utils::LargeAlloc(const std::size_t bytes, const std::size_t alignment, const bool) noexcept
+{
+    return AlignedAlloc(bytes, alignment);
+}
+
+void Core::Utils::LargeFree(void * const data, const std::size_t, const std::size_t) noexcept
+{
+    AlignedFree(data);
+}
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Huge page and NUMA aware allocation of large buffers
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace Core::Utils
+{
+    /** @brief Get the size of a huge page (2MiB when it can't be queried) */
+    [[nodiscard]] std::size_t HugePageSize(void) noexcept;
+
+    /** @brief Allocate a large buffer backed by huge pages when possible, you must use LargeFree to free the memory
+     *  Buffers of at least one huge page are mapped with MAP_HUGETLB, or fall back to transparent huge pages (MADV_HUGEPAGE)
+     *  Their pages are bound to the NUMA node of the calling thread when 'bindToLocalNode' is set
+     *  Smaller buffers, over-aligned requests and other platforms use AlignedAlloc
+     *  @return nullptr if the allocation failed */
+    [[nodiscard]] void *LargeAlloc(const std::size_t bytes, const std::size_t alignment, const bool bindToLocalNode = true) noexcept;
+
+    /** @brief Free a buffer allocated with LargeAlloc, 'bytes' and 'alignment' must match the allocation */
+    void LargeFree(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept;
+}
@@ -3,40 +3,47 @@
  * @ Description: MPMC Queue
  */
 
+#include <iterator>
 #include <stdexcept>
 
-template<typename Type>
-inline Core::MPMCQueue<Type>::MPMCQueue(const std::size_t capacity)
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+inline Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::MPMCQueue(const std::size_t capacity)
     : _tailCache(Cache { Buffer { capacity - 1, nullptr } })
 {
     if (!((capacity >= 2) && ((capacity & (capacity - 1)) == 0)))
         throw std::invalid_argument("Core::MPMCQueue: Buffer capacity must be a power of 2");
     else if (_tailCache.buffer.mask < 2)
         throw std::logic_error("Core::MPMCQueue: Capacity must be >= 2");
-    else if (_tailCache.buffer.data = reinterpret_cast<Cell *>(Utils::AlignedAlloc<alignof(Cell)>(sizeof(Cell) * capacity)); !_tailCache.buffer.data)
+    else if (capacity < CellLayout::template MinCapacity<sizeof(Cell)>)
+        throw std::logic_error("Core::MPMCQueue: Capacity is too small for the cell layout");
+    else if (_tailCache.buffer.data = reinterpret_cast<Cell *>(AllocPolicy::Allocate(sizeof(Cell) * capacity, alignof(Cell))); !_tailCache.buffer.data)
         throw std::runtime_error("Core::MPMCQueue: Malloc failed");
     for (auto i = 0ul; i < capacity; ++i)
-        new (&_tailCache.buffer.data[i].sequence) decltype(Cell::sequence)(i);
+        new (&CellAt(_tailCache.buffer.data, i, _tailCache.buffer.mask).sequence) decltype(Cell::sequence)(i);
     _headCache = _tailCache;
 }
 
-template<typename Type>
-inline Core::MPMCQueue<Type>::~MPMCQueue(void) noexcept_destructible(Type)
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+inline Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::~MPMCQueue(void) noexcept_destructible(Type)
 {
     clear();
-    Utils::AlignedFree(_tailCache.buffer.data);
+    AllocPolicy::Deallocate(_tailCache.buffer.data, sizeof(Cell) * (_tailCache.buffer.mask + 1), alignof(Cell));
 }
 
-template<typename Type>
-inline std::size_t Core::MPMCQueue<Type>::size(void) const noexcept
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+inline std::size_t Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::size(void) const noexcept
 {
-    return _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_relaxed);
+    const auto head = _head.load(std::memory_order_relaxed);
+    const auto tail = _tail.load(std::memory_order_relaxed);
+
+    // Consumers may move the head past a stale tail
+    return tail > head ? tail - head : 0ul;
 }
 
-template<typename Type>
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
 template<bool MoveOnSuccess, typename ...Args>
 inline std::enable_if_t<std::is_constructible_v<Type, Args...>, bool>
-        Core::MPMCQueue<Type>::push(Args &&...args)
+        Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::push(Args &&...args)
     noexcept_constructible(Type, Args...)
 {
     auto pos = _tail.load(std::memory_order_relaxed);
@@ -45,26 +52,30 @@ inline std::enable_if_t<std::is_constructible_v<Type, Args...>, bool>
     Cell *cell;
 
     while (true) {
-        cell = &data[pos & mask];
+        cell = &CellAt(data, pos, mask);
         const auto sequence = cell->sequence.load(std::memory_order_acquire);
         if (sequence == pos) {
             if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
                 break;
-        } else if (sequence < pos)
+        } else if (sequence < pos) {
+            _stats.onPushFailure();
             return false;
-        else
+        } else
             pos = _tail.load(std::memory_order_relaxed);
+        _stats.onPushRetry();
     }
     if constexpr (MoveOnSuccess)
         new (&cell->data) Type(std::move(args)...);
     else
         new (&cell->data) Type(std::forward<Args>(args)...);
     cell->sequence.store(pos + 1, std::memory_order_release);
+    _notEmpty.notifyOne();
+    _stats.onPush(1, [this] { return size(); });
     return true;
 }
 
-template<typename Type>
-inline bool Core::MPMCQueue<Type>::pop(Type &value)
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+inline bool Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::pop(Type &value)
     noexcept(nothrow_destructible(Type) && nothrow_forward_constructible(Type))
 {
     auto pos = _head.load(std::memory_order_relaxed);
@@ -73,16 +84,18 @@ inline bool Core::MPMCQueue<Type>::pop(Type &value)
     Cell *cell;
 
     while (true) {
-        cell = &data[pos & mask];
+        cell = &CellAt(data, pos, mask);
         const auto sequence = cell->sequence.load(std::memory_order_acquire);
         const auto next = pos + 1;
         if (sequence == next) {
             if (_head.compare_exchange_weak(pos, next, std::memory_order_relaxed))
                 break;
-        } else if (sequence < next)
+        } else if (sequence < next) {
+            _stats.onPopFailure();
             return false;
-        else
+        } else
             pos = _head.load(std::memory_order_relaxed);
+        _stats.onPopRetry();
     }
     if constexpr (std::is_move_assignable_v<Type>)
         value = std::move(cell->data);
@@ -90,5 +103,135 @@ inline bool Core::MPMCQueue<Type>::pop(Type &value)
         value = cell->data;
     cell->data.~Type();
     cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    _notFull.notifyOne();
+    _stats.onPop(1);
     return true;
 }
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+template<typename ...Args>
+inline void Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::pushWait(Args &&...args) noexcept_constructible(Type, Args...)
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::MPMCQueue: Blocking operations require a wait policy");
+
+    _notFull.wait([&] { return push<false>(std::forward<Args>(args)...); });
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+template<typename ...Args>
+inline bool Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::pushWaitFor(const std::chrono::nanoseconds timeout, Args &&...args)
+    noexcept_constructible(Type, Args...)
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::MPMCQueue: Blocking operations require a wait policy");
+
+    return _notFull.waitFor([&] { return push<false>(std::forward<Args>(args)...); }, timeout);
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+inline void Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::popWait(Type &value)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::MPMCQueue: Blocking operations require a wait policy");
+
+    _notEmpty.wait([&] { return pop(value); });
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+inline bool Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::popWaitFor(Type &value, const std::chrono::nanoseconds timeout)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::MPMCQueue: Blocking operations require a wait policy");
+
+    return _notEmpty.waitFor([&] { return pop(value); }, timeout);
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+template<bool AllowLess, typename InputIterator>
+inline std::size_t Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::pushRangeImpl(const InputIterator from, const InputIterator to)
+    noexcept_forward_iterator_constructible(InputIterator)
+{
+    const auto requested = static_cast<std::size_t>(std::distance(from, to));
+    const auto mask = _tailCache.buffer.mask;
+    const auto capacity = mask + 1;
+    auto * const data = _tailCache.buffer.data;
+    auto pos = _tail.load(std::memory_order_relaxed);
+    std::size_t count;
+
+    if (!requested)
+        return 0;
+    while (true) {
+        const auto used = pos - _head.load(std::memory_order_acquire);
+        if (used > capacity) { // Stale tail, the head went past it
+            pos = _tail.load(std::memory_order_relaxed);
+            _stats.onPushRetry();
+            continue;
+        }
+        const auto available = capacity - used;
+        if (requested <= available)
+            count = requested;
+        else if (AllowLess && available)
+            count = available;
+        else {
+            _stats.onPushFailure();
+            return 0;
+        }
+        if (_tail.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+            break;
+        _stats.onPushRetry();
+    }
+    auto it = from;
+    for (auto i = 0ul; i < count; ++i, ++it) {
+        auto &cell = CellAt(data, pos + i, mask);
+        // A consumer may still be extracting the previous value of the cell
+        while (cell.sequence.load(std::memory_order_acquire) != pos + i);
+        new (&cell.data) Type(*it);
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    _notEmpty.notifyAll();
+    _stats.onPush(count, [this] { return size(); });
+    return count;
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout, typename AllocPolicy>
+template<bool AllowLess, typename OutputIterator>
+inline std::size_t Core::MPMCQueue<Type, WaitPolicy, Stats, CellLayout, AllocPolicy>::popRangeImpl(const OutputIterator from, const OutputIterator to)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    const auto requested = static_cast<std::size_t>(std::distance(from, to));
+    const auto mask = _headCache.buffer.mask;
+    auto * const data = _headCache.buffer.data;
+    auto pos = _head.load(std::memory_order_relaxed);
+    std::size_t count;
+
+    if (!requested)
+        return 0;
+    while (true) {
+        const auto available = _tail.load(std::memory_order_acquire) - pos;
+        if (requested <= available)
+            count = requested;
+        else if (AllowLess && available)
+            count = available;
+        else {
+            _stats.onPopFailure();
+            return 0;
+        }
+        if (_head.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+            break;
+        _stats.onPopRetry();
+    }
+    auto it = from;
+    for (auto i = 0ul; i < count; ++i, ++it) {
+        auto &cell = CellAt(data, pos + i, mask);
+        // A producer may still be constructing the value of the cell
+        while (cell.sequence.load(std::memory_order_acquire) != pos + i + 1);
+        if constexpr (std::is_move_assignable_v<Type>)
+            *it = std::move(cell.data);
+        else
+            *it = cell.data;
+        cell.data.~Type();
+        cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+    }
+    _notFull.notifyAll();
+    _stats.onPop(count);
+    return count;
+}
@@ -0,0 +1,170 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: MPSC Queue
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+
+#include "Utils.hpp"
+#include "CellLayout.hpp"
+#include "QueueStats.hpp"
+#include "WaitPolicy.hpp"
+
+namespace Core
+{
+    template<typename Type, typename WaitPolicy = NoWaitPolicy, typename Stats = NoQueueStats, typename CellLayout = PackedCellLayout>
+    class MPSCQueue;
+}
+
+/**
+ * @brief The MPSC queue is a lock-free queue that supports Multiple Producers but only a Single Consumer
+ * Producers use the same sequence cells as the MPMC queue while the consumer never executes a CAS,
+ * which makes it suitable for a real-time thread draining many producers
+ *
+ * @tparam Type to be inserted
+ * @tparam WaitPolicy Policy used by blocking operations, NoWaitPolicy disables them
+ * @tparam Stats Policy recording usage statistics, NoQueueStats disables them
+ * @tparam CellLayout Policy placing cells in memory, padded or scrambled layouts prevent false sharing between neighboring cells
+ */
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+class alignas_double_cacheline Core::MPSCQueue
+{
+public:
+    /** @brief Alignment of a cell, depends on the cell layout */
+    static constexpr std::size_t CellAlignment = std::max({ CellLayout::CellAlignment, alignof(Type), alignof(std::atomic<std::size_t>) });
+
+    /** @brief Each cell represent the queued type and a sequence index */
+    struct alignas(CellAlignment) Cell
+    {
+        std::atomic<std::size_t> sequence { 0 };
+        Type data;
+    };
+
+    /** @brief Buffer structure containing all cells */
+    struct Buffer
+    {
+        std::size_t mask { 0 };
+        Cell *data { nullptr };
+    };
+
+    /** @brief Cache of producers or consumer */
+    struct Cache
+    {
+        Buffer buffer;
+    };
+
+    /** @brief Default constructor initialize the queue */
+    MPSCQueue(const std::size_t size);
+
+    /** @brief Destruct and release all memory (unsafe) */
+    ~MPSCQueue(void) noexcept_destructible(Type);
+
+    /** @brief Return the size of the queue */
+    [[nodiscard]] std::size_t size(void) const noexcept;
+
+    /** @brief Push a single element into the queue (any thread)
+     *  @return true if the element has been inserted */
+    template<bool MoveOnSuccess = false, typename ...Args>
+    [[nodiscard]] std::enable_if_t<std::is_constructible_v<Type, Args...>, bool>
+            push(Args &&...args)
+        noexcept_constructible(Type, Args...);
+
+    /** @brief Pop a single element from the queue (consumer only)
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool pop(Type &value)
+        noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type));
+
+    /** @brief Push a single element into the queue, blocking while the queue is full */
+    template<typename ...Args>
+    void pushWait(Args &&...args) noexcept_constructible(Type, Args...);
+
+    /** @brief Push a single element into the queue, blocking while the queue is full for at most 'timeout'
+     *  @return true if the element has been inserted */
+    template<typename ...Args>
+    [[nodiscard]] bool pushWaitFor(const std::chrono::nanoseconds timeout, Args &&...args) noexcept_constructible(Type, Args...);
+
+    /** @brief Pop a single element from the queue, blocking while the queue is empty */
+    void popWait(Type &value) noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type));
+
+    /** @brief Pop a single element from the queue, blocking while the queue is empty for at most 'timeout'
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool popWaitFor(Type &value, const std::chrono::nanoseconds timeout)
+        noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type));
+
+    /** @brief Push exactly 'to - from' elements into the queue, constructed from the dereferenced iterators
+     *  The whole block of cells is claimed at once, use move iterators to move elements
+     *  @return Success on true */
+    template<typename InputIterator>
+    [[nodiscard]] bool tryPushRange(const InputIterator from, const InputIterator to)
+        noexcept_forward_iterator_constructible(InputIterator)
+        { return pushRangeImpl<false>(from, to); }
+
+    /** @brief Pop exactly 'to - from' elements from the queue (consumer only)
+     *  @return Success on true */
+    template<typename OutputIterator>
+    [[nodiscard]] bool tryPopRange(const OutputIterator from, const OutputIterator to)
+        noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+        { return popRangeImpl<false>(from, to); }
+
+    /** @brief Push up to 'to - from' elements into the queue, constructed from the dereferenced iterators
+     *  @return The number of inserted elements */
+    template<typename InputIterator>
+    [[nodiscard]] std::size_t pushRange(const InputIterator from, const InputIterator to)
+        noexcept_forward_iterator_constructible(InputIterator)
+        { return pushRangeImpl<true>(from, to); }
+
+    /** @brief Drain up to 'to - from' published elements from the queue (consumer only)
+     *  @return The number of extracted elements */
+    template<typename OutputIterator>
+    [[nodiscard]] std::size_t popRange(const OutputIterator from, const OutputIterator to)
+        noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+        { return popRangeImpl<true>(from, to); }
+
+    /** @brief Get a copy of the usage statistics, always empty when using NoQueueStats */
+    [[nodiscard]] QueueStatsSnapshot stats(void) const noexcept { return _stats.snapshot(); }
+
+    /** @brief Reset the usage statistics */
+    void resetStats(void) noexcept { _stats.reset(); }
+
+    /** @brief Clear all elements of the queue (unsafe) */
+    void clear(void) noexcept_destructible(Type) { for (Type tmp; pop(tmp);); }
+
+private:
+    alignas_cacheline std::atomic<std::size_t> _tail { 0 }; // Tail accessed by producers
+    alignas_cacheline Cache _tailCache; // Cache accessed by producers
+    alignas_cacheline std::atomic<std::size_t> _head { 0 }; // Head written by the consumer, read by ranged producers
+    alignas_cacheline Cache _headCache; // Cache accessed by the consumer
+
+    [[no_unique_address]] WaitPolicy _notEmpty {}; // Parks the consumer while the queue is empty
+    [[no_unique_address]] WaitPolicy _notFull {}; // Parks producers while the queue is full
+
+    [[no_unique_address]] Stats _stats {}; // Usage statistics
+
+    /** @brief Copy and move constructors disabled */
+    MPSCQueue(const MPSCQueue &other) = delete;
+    MPSCQueue(MPSCQueue &&other) = delete;
+
+    /** @brief Get the cell of a queue position */
+    [[nodiscard]] static Cell &CellAt(Cell * const data, const std::size_t pos, const std::size_t mask) noexcept
+        { return data[CellLayout::template Index<sizeof(Cell)>(pos, mask)]; }
+
+    /** @brief Claim a contiguous block of cells with a single CAS then fill them */
+    template<bool AllowLess, typename InputIterator>
+    [[nodiscard]] std::size_t pushRangeImpl(const InputIterator from, const InputIterator to)
+        noexcept_forward_iterator_constructible(InputIterator);
+
+    /** @brief Drain the published cells at the head then release them with a single store */
+    template<bool AllowLess, typename OutputIterator>
+    [[nodiscard]] std::size_t popRangeImpl(const OutputIterator from, const OutputIterator to)
+        noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type));
+};
+
+static_assert_sizeof(Core::MPSCQueue<int>, 4 * Core::CacheLineSize);
+static_assert_alignof_double_cacheline(Core::MPSCQueue<int>);
+
+#include "MPSCQueue.ipp"
@@ -0,0 +1,217 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: MPSC Queue
+ */
+
+#include <iterator>
+#include <stdexcept>
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+inline Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::MPSCQueue(const std::size_t capacity)
+    : _tailCache(Cache { Buffer { capacity - 1, nullptr } })
+{
+    if (!((capacity >= 2) && ((capacity & (capacity - 1)) == 0)))
+        throw std::invalid_argument("Core::MPSCQueue: Buffer capacity must be a power of 2");
+    else if (_tailCache.buffer.mask < 2)
+        throw std::logic_error("Core::MPSCQueue: Capacity must be >= 2");
+    else if (capacity < CellLayout::template MinCapacity<sizeof(Cell)>)
+        throw std::logic_error("Core::MPSCQueue: Capacity is too small for the cell layout");
+    else if (_tailCache.buffer.data = reinterpret_cast<Cell *>(Utils::AlignedAlloc<alignof(Cell)>(sizeof(Cell) * capacity)); !_tailCache.buffer.data)
+        throw std::runtime_error("Core::MPSCQueue: Malloc failed");
+    for (auto i = 0ul; i < capacity; ++i)
+        new (&CellAt(_tailCache.buffer.data, i, _tailCache.buffer.mask).sequence) decltype(Cell::sequence)(i);
+    _headCache = _tailCache;
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+inline Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::~MPSCQueue(void) noexcept_destructible(Type)
+{
+    clear();
+    Utils::AlignedFree(_tailCache.buffer.data);
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+inline std::size_t Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::size(void) const noexcept
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    const auto tail = _tail.load(std::memory_order_relaxed);
+
+    // The consumer may move the head past a stale tail
+    return tail > head ? tail - head : 0ul;
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+template<bool MoveOnSuccess, typename ...Args>
+inline std::enable_if_t<std::is_constructible_v<Type, Args...>, bool>
+        Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::push(Args &&...args)
+    noexcept_constructible(Type, Args...)
+{
+    auto pos = _tail.load(std::memory_order_relaxed);
+    auto * const data = _tailCache.buffer.data;
+    const auto mask = _tailCache.buffer.mask;
+    Cell *cell;
+
+    while (true) {
+        cell = &CellAt(data, pos, mask);
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        if (sequence == pos) {
+            if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (sequence < pos) {
+            _stats.onPushFailure();
+            return false;
+        } else
+            pos = _tail.load(std::memory_order_relaxed);
+        _stats.onPushRetry();
+    }
+    if constexpr (MoveOnSuccess)
+        new (&cell->data) Type(std::move(args)...);
+    else
+        new (&cell->data) Type(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    _notEmpty.notifyOne();
+    _stats.onPush(1, [this] { return size(); });
+    return true;
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+inline bool Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::pop(Type &value)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    const auto pos = _head.load(std::memory_order_relaxed);
+    const auto mask = _headCache.buffer.mask;
+    auto &cell = CellAt(_headCache.buffer.data, pos, mask);
+
+    if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+        _stats.onPopFailure();
+        return false;
+    }
+    if constexpr (std::is_move_assignable_v<Type>)
+        value = std::move(cell.data);
+    else
+        value = cell.data;
+    cell.data.~Type();
+    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+    _head.store(pos + 1, std::memory_order_release);
+    _notFull.notifyOne();
+    _stats.onPop(1);
+    return true;
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+template<typename ...Args>
+inline void Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::pushWait(Args &&...args) noexcept_constructible(Type, Args...)
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::MPSCQueue: Blocking operations require a wait policy");
+
+    _notFull.wait([&] { return push<false>(std::forward<Args>(args)...); });
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+template<typename ...Args>
+inline bool Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::pushWaitFor(const std::chrono::nanoseconds timeout, Args &&...args)
+    noexcept_constructible(Type, Args...)
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::MPSCQueue: Blocking operations require a wait policy");
+
+    return _notFull.waitFor([&] { return push<false>(std::forward<Args>(args)...); }, timeout);
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+inline void Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::popWait(Type &value)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::MPSCQueue: Blocking operations require a wait policy");
+
+    _notEmpty.wait([&] { return pop(value); });
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+inline bool Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::popWaitFor(Type &value, const std::chrono::nanoseconds timeout)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::MPSCQueue: Blocking operations require a wait policy");
+
+    return _notEmpty.waitFor([&] { return pop(value); }, timeout);
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+template<bool AllowLess, typename InputIterator>
+inline std::size_t Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::pushRangeImpl(const InputIterator from, const InputIterator to)
+    noexcept_forward_iterator_constructible(InputIterator)
+{
+    const auto requested = static_cast<std::size_t>(std::distance(from, to));
+    const auto mask = _tailCache.buffer.mask;
+    const auto capacity = mask + 1;
+    auto * const data = _tailCache.buffer.data;
+    auto pos = _tail.load(std::memory_order_relaxed);
+    std::size_t count;
+
+    if (!requested)
+        return 0;
+    while (true) {
+        const auto used = pos - _head.load(std::memory_order_acquire);
+        if (used > capacity) { // Stale tail, the head went past it
+            pos = _tail.load(std::memory_order_relaxed);
+            _stats.onPushRetry();
+            continue;
+        }
+        const auto available = capacity - used;
+        if (requested <= available)
+            count = requested;
+        else if (AllowLess && available)
+            count = available;
+        else {
+            _stats.onPushFailure();
+            return 0;
+        }
+        if (_tail.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+            break;
+        _stats.onPushRetry();
+    }
+    auto it = from;
+    for (auto i = 0ul; i < count; ++i, ++it) {
+        auto &cell = CellAt(data, pos + i, mask);
+        // The consumer may still be extracting the previous value of the cell
+        while (cell.sequence.load(std::memory_order_acquire) != pos + i);
+        new (&cell.data) Type(*it);
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    _notEmpty.notifyOne();
+    _stats.onPush(count, [this] { return size(); });
+    return count;
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename CellLayout>
+template<bool AllowLess, typename OutputIterator>
+inline std::size_t Core::MPSCQueue<Type, WaitPolicy, Stats, CellLayout>::popRangeImpl(const OutputIterator from, const OutputIterator to)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    const auto requested = static_cast<std::size_t>(std::distance(from, to));
+    const auto mask = _headCache.buffer.mask;
+    auto * const data = _headCache.buffer.data;
+    const auto pos = _head.load(std::memory_order_relaxed);
+    std::size_t count = 0;
+
+    // Producers may publish out of order, only the contiguous published cells are drained
+    while (count < requested && CellAt(data, pos + count, mask).sequence.load(std::memory_order_acquire) == pos + count + 1)
+        ++count;
+    if (!count || (!AllowLess && count != requested)) {
+        _stats.onPopFailure();
+        return 0;
+    }
+    auto it = from;
+    for (auto i = 0ul; i < count; ++i, ++it) {
+        auto &cell = CellAt(data, pos + i, mask);
+        if constexpr (std::is_move_assignable_v<Type>)
+            *it = std::move(cell.data);
+        else
+            *it = cell.data;
+        cell.data.~Type();
+        cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+    }
+    _head.store(pos + count, std::memory_order_release);
+    _notFull.notifyAll();
+    _stats.onPop(count);
+    return count;
+}
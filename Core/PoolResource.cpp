@@ -0,0 +1,246 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Thread safe size-class pool memory resource
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+
+#include "PoolResource.hpp"
+#include "Vector.hpp"
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Maximum number of resources a single thread can cache, other resources use the global free lists directly */
+    constexpr std::size_t MaxThreadCaches = 8ul;
+
+    /** @brief Registry of alive resources, only used on cold paths (construction, destruction, cache acquisition, thread exit) */
+    struct Registry
+    {
+        std::mutex mutex {};
+        Vector<std::uint64_t> ids {};
+        std::uint64_t nextId { 1u };
+    };
+
+    [[nodiscard]] Registry &GetRegistry(void) noexcept
+    {
+        static Registry registry;
+
+        return registry;
+    }
+
+    /** @brief Caches of the calling thread, flushed to their resources on thread exit */
+    struct ThreadCaches
+    {
+        struct Entry
+        {
+            PoolResource *resource { nullptr };
+            PoolResource::Cache cache {};
+        };
+
+        std::uint64_t ids[MaxThreadCaches] {};
+        Entry entries[MaxThreadCaches] {};
+
+        ~ThreadCaches(void) noexcept
+        {
+            if (std::all_of(std::begin(ids), std::end(ids), [](const auto id) { return !id; }))
+                return;
+            auto &registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (auto i = 0ul; i < MaxThreadCaches; ++i) {
+                if (ids[i] && registry.ids.find(ids[i]) != registry.ids.end())
+                    entries[i].resource->flush(entries[i].cache);
+            }
+        }
+
+        /** @brief Find the cache of a resource or bind a free entry to it
+         *  @return nullptr if every entry is bound to an alive resource */
+        [[nodiscard]] PoolResource::Cache *find(const std::uint64_t id, PoolResource * const resource) noexcept
+        {
+            for (auto i = 0ul; i < MaxThreadCaches; ++i) {
+                if (ids[i] == id) [[likely]]
+                    return &entries[i].cache;
+            }
+            return bind(id, resource);
+        }
+
+        /** @brief Bind an entry that is unused or whose resource has been destroyed */
+        [[nodiscard]] PoolResource::Cache *bind(const std::uint64_t id, PoolResource * const resource) noexcept
+        {
+            auto &registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (auto i = 0ul; i < MaxThreadCaches; ++i) {
+                if (ids[i] && registry.ids.find(ids[i]) != registry.ids.end())
+                    continue;
+                ids[i] = id;
+                entries[i] = Entry { resource, PoolResource::Cache {} };
+                return &entries[i].cache;
+            }
+            return nullptr;
+        }
+    };
+
+    thread_local ThreadCaches Caches {};
+}
+
+PoolResource::PoolResource(void)
+{
+    auto &registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    _id = registry.nextId++;
+    registry.ids.push(_id);
+}
+
+PoolResource::~PoolResource(void) noexcept
+{
+    {
+        auto &registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.ids.erase(registry.ids.find(_id));
+    }
+    for (auto slab = _slabs.load(std::memory_order_acquire); slab;) {
+        const auto next = slab->next;
+        Utils::AlignedFree(slab->data);
+        slab = next;
+    }
+}
+
+void *PoolResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    const auto sizeClass = ClassOf(bytes, alignment);
+
+    if (sizeClass == ClassCount) [[unlikely]] {
+        if (const auto data = Utils::AlignedAlloc(bytes, std::max(alignment, alignof(std::max_align_t))); data)
+            return data;
+        throw std::bad_alloc();
+    }
+    if (const auto cache = Caches.find(_id, this); cache) [[likely]] {
+        auto &list = cache->lists[sizeClass];
+        if (!list.head && !refill(list, sizeClass)) [[unlikely]]
+            throw std::bad_alloc();
+        const auto block = list.head;
+        list.head = block->next;
+        --list.count;
+        return block;
+    }
+    // No thread cache available, take a batch and return its remaining blocks
+    Cache::List list;
+    if (!refill(list, sizeClass))
+        throw std::bad_alloc();
+    if (list.head->next)
+        pushBatch(sizeClass, list.head->next);
+    return list.head;
+}
+
+void PoolResource::do_deallocate(void *data, std::size_t bytes, std::size_t alignment)
+{
+    const auto sizeClass = ClassOf(bytes, alignment);
+    const auto block = reinterpret_cast<Block *>(data);
+
+    if (sizeClass == ClassCount) [[unlikely]] {
+        Utils::AlignedFree(data);
+        return;
+    }
+    const auto cache = Caches.find(_id, this);
+    if (!cache) [[unlikely]] {
+        block->next = nullptr;
+        pushBatch(sizeClass, block);
+        return;
+    }
+    auto &list = cache->lists[sizeClass];
+    block->next = list.head;
+    list.head = block;
+    // Keep a batch in the cache and return the other one
+    if (++list.count > 2 * BatchSize) [[unlikely]] {
+        auto last = list.head;
+        for (auto i = 1u; i < BatchSize; ++i)
+            last = last->next;
+        const auto batch = list.head;
+        list.head = last->next;
+        list.count -= BatchSize;
+        last->next = nullptr;
+        pushBatch(sizeClass, batch);
+    }
+}
+
+void PoolResource::flush(Cache &cache) noexcept
+{
+    for (auto sizeClass = 0ul; sizeClass < ClassCount; ++sizeClass) {
+        pushList(sizeClass, cache.lists[sizeClass].head);
+        cache.lists[sizeClass] = Cache::List {};
+    }
+}
+
+bool PoolResource::refill(Cache::List &list, const std::size_t sizeClass) noexcept
+{
+    if (const auto batch = popBatch(sizeClass); batch) {
+        std::uint32_t count = 0u;
+        for (auto block = batch; block; block = block->next)
+            ++count;
+        list.head = batch;
+        list.count = count;
+        return true;
+    }
+
+    // Carve a new slab, its header is stored after the blocks
+    const auto blockSize = ClassSize(sizeClass);
+    const auto blockCount = SlabSize / blockSize;
+    const auto data = Utils::AlignedAlloc<std::byte>(blockSize * blockCount + sizeof(Slab), blockSize);
+    if (!data)
+        return false;
+    const auto slab = new (data + blockSize * blockCount) Slab { _slabs.load(std::memory_order_relaxed), data };
+    while (!_slabs.compare_exchange_weak(slab->next, slab, std::memory_order_release, std::memory_order_relaxed));
+    _reservedBytes.fetch_add(blockSize * blockCount, std::memory_order_relaxed);
+    for (auto i = 0ul; i < blockCount; ++i)
+        new (data + i * blockSize) Block { i + 1 < blockCount ? reinterpret_cast<Block *>(data + (i + 1) * blockSize) : nullptr };
+    // Keep the first batch, share the others
+    const auto kept = std::min<std::size_t>(blockCount, BatchSize);
+    const auto rest = reinterpret_cast<Block *>(data + (kept - 1) * blockSize);
+    pushList(sizeClass, rest->next);
+    rest->next = nullptr;
+    list.head = reinterpret_cast<Block *>(data);
+    list.count = static_cast<std::uint32_t>(kept);
+    return true;
+}
+
+void PoolResource::pushBatch(const std::size_t sizeClass, Block * const batch) noexcept
+{
+    auto &head = _freeLists[sizeClass].head;
+    auto expected = head.load(std::memory_order_relaxed);
+    std::uint64_t desired;
+
+    do {
+        batch->nextBatch = reinterpret_cast<Block *>(expected & AddressMask);
+        desired = reinterpret_cast<std::uintptr_t>(batch) | ((expected & ~AddressMask) + (1ull << AddressBits));
+    } while (!head.compare_exchange_weak(expected, desired, std::memory_order_release, std::memory_order_relaxed));
+}
+
+PoolResource::Block *PoolResource::popBatch(const std::size_t sizeClass) noexcept
+{
+    auto &head = _freeLists[sizeClass].head;
+    auto expected = head.load(std::memory_order_acquire);
+
+    while (const auto batch = reinterpret_cast<Block *>(expected & AddressMask)) {
+        const auto desired = reinterpret_cast<std::uintptr_t>(RacyNextBatch(batch)) | ((expected & ~AddressMask) + (1ull << AddressBits));
+        if (head.compare_exchange_weak(expected, desired, std::memory_order_acquire, std::memory_order_acquire))
+            return batch;
+    }
+    return nullptr;
+}
+
+void PoolResource::pushList(const std::size_t sizeClass, Block *head) noexcept
+{
+    while (head) {
+        auto last = head;
+        for (auto i = 1u; i < BatchSize && last->next; ++i)
+            last = last->next;
+        const auto batch = head;
+        head = last->next;
+        last->next = nullptr;
+        pushBatch(sizeClass, batch);
+    }
+}
@@ -0,0 +1,152 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Thread safe size-class pool memory resource
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "PMR.hpp"
+#include "Utils.hpp"
+
+namespace Core
+{
+    class PoolResource;
+}
+
+/**
+ * @brief Thread safe pool resource serving fixed-size blocks from power of 2 size classes
+ * Each thread allocates from and releases to its own cache without any synchronization
+ * Caches exchange batches of blocks with a lock-free global free list per size class,
+ * which makes cross-thread deallocations cheap (a block may be released by any thread)
+ * Requests larger than 'MaxBlockSize' are forwarded to the aligned heap
+ *
+ * Can be used as the 'Allocator' of Core::UniqueAlloc in place of the pmr pools
+ */
+class alignas_cacheline Core::PoolResource final : public std::pmr::memory_resource
+{
+public:
+    /** @brief Smallest block size, also the minimal alignment of any block */
+    static constexpr std::size_t MinBlockSize = 16ul;
+
+    /** @brief Largest pooled block size */
+    static constexpr std::size_t MaxBlockSize = 4096ul;
+
+    /** @brief Number of size classes */
+    static constexpr std::size_t ClassCount = 9ul;
+
+    /** @brief Number of blocks exchanged between a thread cache and the global free list */
+    static constexpr std::uint32_t BatchSize = 64u;
+
+    /** @brief Size of a slab carved into blocks */
+    static constexpr std::size_t SlabSize = 64ul * 1024ul;
+
+    /** @brief Header of a free block, the first block of a batch also links the next batch */
+    struct Block
+    {
+        Block *next { nullptr };
+        Block *nextBatch { nullptr };
+    };
+
+    /** @brief Per thread cache of free blocks */
+    struct Cache
+    {
+        struct List
+        {
+            Block *head { nullptr };
+            std::uint32_t count { 0u };
+        };
+
+        List lists[ClassCount] {};
+    };
+
+    /** @brief Construct an empty resource, slabs are allocated on demand */
+    PoolResource(void);
+
+    /** @brief Release every slab, all blocks must have been deallocated */
+    virtual ~PoolResource(void) noexcept;
+
+    /** @brief Get the size class of a request, ClassCount if it is not pooled */
+    [[nodiscard]] static constexpr std::size_t ClassOf(const std::size_t bytes, const std::size_t alignment) noexcept
+    {
+        const auto size = std::max({ bytes, alignment, MinBlockSize });
+        if (size > MaxBlockSize)
+            return ClassCount;
+        return static_cast<std::size_t>(std::bit_width(size - 1)) - static_cast<std::size_t>(std::bit_width(MinBlockSize - 1));
+    }
+
+    /** @brief Get the block size of a size class */
+    [[nodiscard]] static constexpr std::size_t ClassSize(const std::size_t sizeClass) noexcept
+        { return MinBlockSize << sizeClass; }
+
+    /** @brief Return the blocks of a cache to the global free lists */
+    void flush(Cache &cache) noexcept;
+
+    /** @brief Get the total number of bytes reserved by the slabs */
+    [[nodiscard]] std::size_t reservedBytes(void) const noexcept { return _reservedBytes.load(std::memory_order_relaxed); }
+
+private:
+    /** @brief Header placed at the end of each slab */
+    struct Slab
+    {
+        Slab *next { nullptr };
+        void *data { nullptr };
+    };
+
+    /** @brief Global free list of a size class, a stack of batches whose head is tagged against ABA
+     *  The tag lives in the 16 upper bits of the pointer, unused by 64 bits user space addresses */
+    struct alignas_cacheline FreeList
+    {
+        std::atomic<std::uint64_t> head { 0u };
+    };
+
+    static_assert(sizeof(void *) == sizeof(std::uint64_t), "Core::PoolResource: Tagged pointers require 64 bits addresses");
+
+    /** @brief Number of bits of a tagged pointer used by the address */
+    static constexpr std::uint64_t AddressBits = 48u;
+
+    /** @brief Mask of the address of a tagged pointer */
+    static constexpr std::uint64_t AddressMask = (1ull << AddressBits) - 1u;
+
+    FreeList _freeLists[ClassCount] {};
+    alignas_cacheline std::atomic<Slab *> _slabs { nullptr };
+    std::atomic<std::size_t> _reservedBytes { 0u };
+    std::uint64_t _id { 0u };
+
+    /** @brief Allocate a block */
+    [[nodiscard]] void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+    /** @brief Release a block */
+    void do_deallocate(void *data, std::size_t bytes, std::size_t alignment) override;
+
+    /** @brief Resources are only equal to themselves */
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        { return this == &other; }
+
+    /** @brief Refill an empty cache list with a batch from the global free list or from a new slab
+     *  @return false if a slab could not be allocated */
+    [[nodiscard]] bool refill(Cache::List &list, const std::size_t sizeClass) noexcept;
+
+    /** @brief Push a batch of blocks to a global free list */
+    void pushBatch(const std::size_t sizeClass, Block * const batch) noexcept;
+
+    /** @brief Pop a batch of blocks from a global free list, nullptr if empty */
+    [[nodiscard]] Block *popBatch(const std::size_t sizeClass) noexcept;
+
+    /** @brief Push a list of blocks to a global free list, split in batches of at most 'BatchSize' blocks */
+    void pushList(const std::size_t sizeClass, Block *head) noexcept;
+
+    /** @brief Read the next batch of a batch that may have been popped and reused meanwhile,
+     *  the value is discarded by the tagged compare exchange in that case */
+    CORE_NO_SANITIZE_THREAD [[nodiscard]] static Block *RacyNextBatch(const Block * const batch) noexcept
+        { return batch->nextBatch; }
+
+    /** @brief Copy and move constructors disabled */
+    PoolResource(const PoolResource &other) = delete;
+    PoolResource(PoolResource &&other) = delete;
+};
@@ -0,0 +1,122 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Statistics policies of the lock-free queues
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    struct QueueStatsSnapshot;
+    struct NoQueueStats;
+    class QueueStats;
+}
+
+/** @brief Copy of the statistics of a queue at a given time */
+struct Core::QueueStatsSnapshot
+{
+    std::uint64_t pushCount { 0u }; // Number of inserted elements
+    std::uint64_t popCount { 0u }; // Number of extracted elements
+    std::uint64_t pushFailures { 0u }; // Number of push attempts that failed because the queue was full
+    std::uint64_t popFailures { 0u }; // Number of pop attempts that failed because the queue was empty
+    std::uint64_t pushRetries { 0u }; // Number of producer retries caused by contention
+    std::uint64_t popRetries { 0u }; // Number of consumer retries caused by contention
+    std::uint64_t peakSize { 0u }; // Highest observed size of the queue
+};
+
+/** @brief The default statistics policy, every hook is a no-op */
+struct Core::NoQueueStats
+{
+    /** @brief Tell if statistics are recorded */
+    static constexpr bool IsEnabled = false;
+
+    /** @brief Producer hooks, 'size' is a callable returning the current size of the queue */
+    template<typename SizeFunc>
+    void onPush(const std::size_t, SizeFunc &&) noexcept {}
+    void onPushFailure(void) noexcept {}
+    void onPushRetry(void) noexcept {}
+
+    /** @brief Consumer hooks */
+    void onPop(const std::size_t) noexcept {}
+    void onPopFailure(void) noexcept {}
+    void onPopRetry(void) noexcept {}
+
+    /** @brief Statistics are always empty */
+    [[nodiscard]] QueueStatsSnapshot snapshot(void) const noexcept { return QueueStatsSnapshot {}; }
+    void reset(void) noexcept {}
+};
+
+/** @brief Statistics policy recording counters, each side of the queue writes to its own cacheline */
+class Core::QueueStats
+{
+public:
+    /** @brief Tell if statistics are recorded */
+    static constexpr bool IsEnabled = true;
+
+    /** @brief Producer hooks, 'size' is a callable returning the current size of the queue */
+    template<typename SizeFunc>
+    void onPush(const std::size_t count, SizeFunc &&size) noexcept
+    {
+        _producer.count.fetch_add(count, std::memory_order_relaxed);
+        const std::uint64_t current = size();
+        for (auto peak = _producer.peakSize.load(std::memory_order_relaxed);
+                current > peak && !_producer.peakSize.compare_exchange_weak(peak, current, std::memory_order_relaxed););
+    }
+    void onPushFailure(void) noexcept { _producer.failures.fetch_add(1, std::memory_order_relaxed); }
+    void onPushRetry(void) noexcept { _producer.retries.fetch_add(1, std::memory_order_relaxed); }
+
+    /** @brief Consumer hooks */
+    void onPop(const std::size_t count) noexcept { _consumer.count.fetch_add(count, std::memory_order_relaxed); }
+    void onPopFailure(void) noexcept { _consumer.failures.fetch_add(1, std::memory_order_relaxed); }
+    void onPopRetry(void) noexcept { _consumer.retries.fetch_add(1, std::memory_order_relaxed); }
+
+    /** @brief Get a copy of the counters (each counter is individually consistent) */
+    [[nodiscard]] QueueStatsSnapshot snapshot(void) const noexcept;
+
+    /** @brief Reset all counters */
+    void reset(void) noexcept;
+
+private:
+    /** @brief Counters of one side of the queue */
+    struct alignas_cacheline Side
+    {
+        std::atomic<std::uint64_t> count { 0u };
+        std::atomic<std::uint64_t> failures { 0u };
+        std::atomic<std::uint64_t> retries { 0u };
+        std::atomic<std::uint64_t> peakSize { 0u }; // Only used by producers
+    };
+
+    Side _producer {};
+    Side _consumer {};
+};
+
+static_assert_sizeof(Core::NoQueueStats, 1);
+static_assert_sizeof_double_cacheline(Core::QueueStats);
+
+inline Core::QueueStatsSnapshot Core::QueueStats::snapshot(void) const noexcept
+{
+    return QueueStatsSnapshot {
+        _producer.count.load(std::memory_order_relaxed),
+        _consumer.count.load(std::memory_order_relaxed),
+        _producer.failures.load(std::memory_order_relaxed),
+        _consumer.failures.load(std::memory_order_relaxed),
+        _producer.retries.load(std::memory_order_relaxed),
+        _consumer.retries.load(std::memory_order_relaxed),
+        _producer.peakSize.load(std::memory_order_relaxed)
+    };
+}
+
+inline void Core::QueueStats::reset(void) noexcept
+{
+    for (auto side : { &_producer, &_consumer }) {
+        side->count.store(0u, std::memory_order_relaxed);
+        side->failures.store(0u, std::memory_order_relaxed);
+        side->retries.store(0u, std::memory_order_relaxed);
+        side->peakSize.store(0u, std::memory_order_relaxed);
+    }
+}
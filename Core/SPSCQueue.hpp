@@ -6,15 +6,20 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <span>
 #include <algorithm>
 
 #include "Utils.hpp"
+#include "AllocPolicy.hpp"
+#include "QueueStats.hpp"
+#include "WaitPolicy.hpp"
 
 namespace Core
 {
-    template<typename Type>
+    template<typename Type, typename WaitPolicy = NoWaitPolicy, typename Stats = NoQueueStats, typename AllocPolicy = DefaultAllocPolicy>
     class SPSCQueue;
 }
 
@@ -23,10 +28,14 @@ namespace Core
  * The queue is really fast compared to other more flexible implementations because the fact that only two thread can simultaneously read / write
  * means that less synchronization is needed for each operation.
  * The queue supports ranged push / pop to insert multiple elements without performance impact
+ * Large payloads can be constructed and consumed in place using the begin / commit API
  *
  * @tparam Type to be inserted
+ * @tparam WaitPolicy Policy used by blocking operations, NoWaitPolicy disables them
+ * @tparam Stats Policy recording usage statistics, NoQueueStats disables them
+ * @tparam AllocPolicy Policy allocating the ring, LargeAllocPolicy backs large rings with huge pages
  */
-template<typename Type>
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
 class alignas_double_cacheline Core::SPSCQueue
 {
 public:
@@ -44,6 +53,23 @@ public:
         std::size_t value { 0u };
     };
 
+    /** @brief Claimed region of the ring buffer, split in two spans when it wraps around */
+    struct Region
+    {
+        std::span<Type> first {};
+        std::span<Type> second {};
+
+        /** @brief Get the total number of claimed cells */
+        [[nodiscard]] std::size_t size(void) const noexcept { return first.size() + second.size(); }
+
+        /** @brief Check if the region is empty */
+        [[nodiscard]] bool empty(void) const noexcept { return first.empty(); }
+
+        /** @brief Access a cell of the region */
+        [[nodiscard]] Type &operator[](const std::size_t index) const noexcept
+            { return index < first.size() ? first[index] : second[index - first.size()]; }
+    };
+
     /** @brief Default constructor, the queue is unsafe to use until 'resize' is called */
     SPSCQueue(void) noexcept = default;
 
@@ -66,6 +92,23 @@ public:
     [[nodiscard]] bool pop(Type &value)
         noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type));
 
+    /** @brief Push a single element into the queue, blocking while the queue is full */
+    template<typename ...Args>
+    void pushWait(Args &&...args) noexcept_constructible(Type, Args...);
+
+    /** @brief Push a single element into the queue, blocking while the queue is full for at most 'timeout'
+     *  @return true if the element has been inserted */
+    template<typename ...Args>
+    [[nodiscard]] bool pushWaitFor(const std::chrono::nanoseconds timeout, Args &&...args) noexcept_constructible(Type, Args...);
+
+    /** @brief Pop a single element from the queue, blocking while the queue is empty */
+    void popWait(Type &value) noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type));
+
+    /** @brief Pop a single element from the queue, blocking while the queue is empty for at most 'timeout'
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool popWaitFor(Type &value, const std::chrono::nanoseconds timeout)
+        noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type));
+
     /** @brief Push exactly 'count' elements into the queue
      *  @tparam ForceCopy If true, will prevent to move construct elements
      *  @return Success on true */
@@ -96,6 +139,27 @@ public:
         noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
         { return popRangeImpl<true>(from, to); }
 
+    /** @brief Claim up to 'count' free cells to construct elements in place (producer only)
+     *  Cells are uninitialized, elements must be constructed with placement new or std::construct_at
+     *  @return The claimed region, may be smaller than 'count' */
+    [[nodiscard]] Region beginWrite(const std::size_t count) noexcept;
+
+    /** @brief Publish the first 'count' elements of the last claimed write region (producer only) */
+    void commitWrite(const std::size_t count) noexcept;
+
+    /** @brief Claim up to 'count' elements to process them in place (consumer only)
+     *  @return The claimed region, may be smaller than 'count' */
+    [[nodiscard]] Region beginRead(const std::size_t count) noexcept;
+
+    /** @brief Destroy and release the first 'count' elements of the last claimed read region (consumer only) */
+    void commitRead(const std::size_t count) noexcept_destructible(Type);
+
+    /** @brief Get a copy of the usage statistics, always empty when using NoQueueStats */
+    [[nodiscard]] QueueStatsSnapshot stats(void) const noexcept { return _stats.snapshot(); }
+
+    /** @brief Reset the usage statistics */
+    void resetStats(void) noexcept { _stats.reset(); }
+
     /** @brief Clear all elements of the queue (unsafe) */
     void clear(void) noexcept_destructible(Type);
 
@@ -112,6 +176,11 @@ private:
     alignas_cacheline std::atomic<size_t> _head { 0u }; // Head accessed by both producer and consumer
     alignas_cacheline Cache _headCache {}; // Cache accessed by producer thread
 
+    [[no_unique_address]] WaitPolicy _notEmpty {}; // Parks consumers while the queue is empty
+    [[no_unique_address]] WaitPolicy _notFull {}; // Parks producers while the queue is full
+
+    [[no_unique_address]] Stats _stats {}; // Usage statistics
+
     /** @brief Copy and move constructors disabled */
     SPSCQueue(const SPSCQueue &other) = delete;
     SPSCQueue(SPSCQueue &&other) = delete;
@@ -3,25 +3,25 @@
  * @ Description: SPSC Queue
  */
 
-template<typename Type>
-inline Core::SPSCQueue<Type>::SPSCQueue(const std::size_t capacity, const bool usedAsBuffer) noexcept
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::SPSCQueue(const std::size_t capacity, const bool usedAsBuffer) noexcept
 {
     _tailCache.buffer.capacity = capacity + usedAsBuffer;
-    _tailCache.buffer.data = reinterpret_cast<Type *>(Utils::AlignedAlloc<alignof(Type)>(sizeof(Type) * _tailCache.buffer.capacity));
+    _tailCache.buffer.data = reinterpret_cast<Type *>(AllocPolicy::Allocate(sizeof(Type) * _tailCache.buffer.capacity, alignof(Type)));
     _headCache.buffer = _tailCache.buffer;
 }
 
-template<typename Type>
-inline Core::SPSCQueue<Type>::~SPSCQueue(void) noexcept_destructible(Type)
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::~SPSCQueue(void) noexcept_destructible(Type)
 {
     clear();
-    Utils::AlignedFree(_tailCache.buffer.data);
+    AllocPolicy::Deallocate(_tailCache.buffer.data, sizeof(Type) * _tailCache.buffer.capacity, alignof(Type));
 }
 
-template<typename Type>
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
 template<typename ...Args>
 inline std::enable_if_t<std::is_constructible_v<Type, Args...>, bool>
-        Core::SPSCQueue<Type>::push(Args &&...args)
+        Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::push(Args &&...args)
     noexcept_constructible(Type, Args...)
 {
     const auto tail = _tail.load(std::memory_order_relaxed);
@@ -31,24 +31,30 @@ inline std::enable_if_t<std::is_constructible_v<Type, Args...>, bool>
         next = 0;
     if (auto head = _tailCache.value; next == head) {
         head = _tailCache.value = _head.load(std::memory_order_acquire);
-        if (next == head)
+        if (next == head) {
+            _stats.onPushFailure();
             return false;
+        }
     }
     new (_tailCache.buffer.data + tail) Type { std::forward<Args>(args)... };
     _tail.store(next, std::memory_order_release);
+    _notEmpty.notifyOne();
+    _stats.onPush(1, [this] { return size(); });
     return true;
 }
 
-template<typename Type>
-inline bool Core::SPSCQueue<Type>::pop(Type &value)
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline bool Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::pop(Type &value)
     noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
 {
     const auto head = _head.load(std::memory_order_relaxed);
 
     if (auto tail = _headCache.value; head == tail) {
         tail = _headCache.value = _tail.load(std::memory_order_acquire);
-        if (head == tail)
+        if (head == tail) {
+            _stats.onPopFailure();
             return false;
+        }
     }
     auto *elem = reinterpret_cast<Type *>(_headCache.buffer.data + head);
     auto next = head + 1;
@@ -60,12 +66,14 @@ inline bool Core::SPSCQueue<Type>::pop(Type &value)
         value = *elem;
     elem->~Type();
     _head.store(next, std::memory_order_release);
+    _notFull.notifyOne();
+    _stats.onPop(1);
     return true;
 }
 
-template<typename Type>
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
 template<bool AllowLess, typename InputIterator>
-inline std::size_t Core::SPSCQueue<Type>::pushRangeImpl(const InputIterator from, const InputIterator to)
+inline std::size_t Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::pushRangeImpl(const InputIterator from, const InputIterator to)
     noexcept_forward_iterator_constructible(InputIterator)
 {
     std::size_t toPush = to - from;
@@ -74,6 +82,8 @@ inline std::size_t Core::SPSCQueue<Type>::pushRangeImpl(const InputIterator from
     auto head = _tailCache.value;
     auto available = capacity - (tail - head);
 
+    if (!toPush)
+        return 0;
     if (available > capacity)
         available -= capacity;
     if (toPush >= available) {
@@ -84,8 +94,10 @@ inline std::size_t Core::SPSCQueue<Type>::pushRangeImpl(const InputIterator from
         if (toPush >= available) {
             if constexpr (AllowLess)
                 toPush = available - 1;
-            else
+            else {
+                _stats.onPushFailure();
                 return 0;
+            }
         }
     }
     auto next = tail + toPush;
@@ -101,12 +113,17 @@ inline std::size_t Core::SPSCQueue<Type>::pushRangeImpl(const InputIterator from
         std::destroy_n(from, toPush);
     }
     _tail.store(next, std::memory_order_release);
+    if (toPush) {
+        _notEmpty.notifyOne();
+        _stats.onPush(toPush, [this] { return size(); });
+    } else
+        _stats.onPushFailure();
     return toPush;
 }
 
-template<typename Type>
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
 template<bool AllowLess, typename OutputIterator>
-inline std::size_t Core::SPSCQueue<Type>::popRangeImpl(const OutputIterator from, const OutputIterator to)
+inline std::size_t Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::popRangeImpl(const OutputIterator from, const OutputIterator to)
     noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
 {
     std::size_t toPop = to - from;
@@ -115,6 +132,8 @@ inline std::size_t Core::SPSCQueue<Type>::popRangeImpl(const OutputIterator from
     auto tail = _headCache.value;
     auto available = tail - head;
 
+    if (!toPop)
+        return 0;
     if (available > capacity)
         available += capacity;
     if (toPop >= available) {
@@ -125,8 +144,10 @@ inline std::size_t Core::SPSCQueue<Type>::popRangeImpl(const OutputIterator from
         if (toPop > available) {
             if constexpr (AllowLess)
                 toPop = available;
-            else
+            else {
+                _stats.onPopFailure();
                 return 0;
+            }
         }
     }
     auto next = head + toPop;
@@ -142,17 +163,136 @@ inline std::size_t Core::SPSCQueue<Type>::popRangeImpl(const OutputIterator from
         std::destroy_n(_headCache.buffer.data + head, toPop);
     }
     _head.store(next, std::memory_order_release);
+    if (toPop) {
+        _notFull.notifyOne();
+        _stats.onPop(toPop);
+    } else
+        _stats.onPopFailure();
     return toPop;
 }
 
-template<typename Type>
-inline void Core::SPSCQueue<Type>::clear(void) noexcept_destructible(Type)
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+template<typename ...Args>
+inline void Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::pushWait(Args &&...args) noexcept_constructible(Type, Args...)
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::SPSCQueue: Blocking operations require a wait policy");
+
+    _notFull.wait([&] { return push(std::forward<Args>(args)...); });
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+template<typename ...Args>
+inline bool Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::pushWaitFor(const std::chrono::nanoseconds timeout, Args &&...args)
+    noexcept_constructible(Type, Args...)
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::SPSCQueue: Blocking operations require a wait policy");
+
+    return _notFull.waitFor([&] { return push(std::forward<Args>(args)...); }, timeout);
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline void Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::popWait(Type &value)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::SPSCQueue: Blocking operations require a wait policy");
+
+    _notEmpty.wait([&] { return pop(value); });
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline bool Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::popWaitFor(Type &value, const std::chrono::nanoseconds timeout)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    static_assert(WaitPolicy::IsEnabled, "Core::SPSCQueue: Blocking operations require a wait policy");
+
+    return _notEmpty.waitFor([&] { return pop(value); }, timeout);
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline typename Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::Region
+    Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::beginWrite(const std::size_t count) noexcept
+{
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    const auto capacity = _tailCache.buffer.capacity;
+    const auto freeCells = [tail, capacity](const std::size_t head) {
+        return (head > tail ? head - tail : capacity - (tail - head)) - 1;
+    };
+    auto available = freeCells(_tailCache.value);
+
+    if (available < count)
+        available = freeCells(_tailCache.value = _head.load(std::memory_order_acquire));
+    const auto claimed = std::min(count, available);
+    if (!claimed && count)
+        _stats.onPushFailure();
+    const auto split = std::min(claimed, capacity - tail);
+    return Region {
+        std::span<Type>(_tailCache.buffer.data + tail, split),
+        std::span<Type>(_tailCache.buffer.data, claimed - split)
+    };
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline void Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::commitWrite(const std::size_t count) noexcept
+{
+    if (!count)
+        return;
+    auto next = _tail.load(std::memory_order_relaxed) + count;
+    if (next >= _tailCache.buffer.capacity)
+        next -= _tailCache.buffer.capacity;
+    _tail.store(next, std::memory_order_release);
+    _notEmpty.notifyOne();
+    _stats.onPush(count, [this] { return size(); });
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline typename Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::Region
+    Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::beginRead(const std::size_t count) noexcept
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    const auto capacity = _headCache.buffer.capacity;
+    const auto usedCells = [head, capacity](const std::size_t tail) {
+        return tail >= head ? tail - head : capacity - (head - tail);
+    };
+    auto available = usedCells(_headCache.value);
+
+    if (available < count)
+        available = usedCells(_headCache.value = _tail.load(std::memory_order_acquire));
+    const auto claimed = std::min(count, available);
+    if (!claimed && count)
+        _stats.onPopFailure();
+    const auto split = std::min(claimed, capacity - head);
+    return Region {
+        std::span<Type>(_headCache.buffer.data + head, split),
+        std::span<Type>(_headCache.buffer.data, claimed - split)
+    };
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline void Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::commitRead(const std::size_t count) noexcept_destructible(Type)
+{
+    if (!count)
+        return;
+    const auto head = _head.load(std::memory_order_relaxed);
+    const auto capacity = _headCache.buffer.capacity;
+    const auto split = std::min(count, capacity - head);
+    std::destroy_n(_headCache.buffer.data + head, split);
+    std::destroy_n(_headCache.buffer.data, count - split);
+    auto next = head + count;
+    if (next >= capacity)
+        next -= capacity;
+    _head.store(next, std::memory_order_release);
+    _notFull.notifyOne();
+    _stats.onPop(count);
+}
+
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline void Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::clear(void) noexcept_destructible(Type)
 {
     for (Type type; pop(type););
 }
 
-template<typename Type>
-inline std::size_t Core::SPSCQueue<Type>::size(void) const noexcept
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline std::size_t Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::size(void) const noexcept
 {
     const auto tail = _tail.load(std::memory_order_seq_cst);
     const auto capacity = _tailCache.buffer.capacity;
@@ -163,18 +303,18 @@ inline std::size_t Core::SPSCQueue<Type>::size(void) const noexcept
     return available;
 }
 
-template<typename Type>
-inline void Core::SPSCQueue<Type>::resize(const std::size_t capacity, const bool usedAsBuffer) noexcept
+template<typename Type, typename WaitPolicy, typename Stats, typename AllocPolicy>
+inline void Core::SPSCQueue<Type, WaitPolicy, Stats, AllocPolicy>::resize(const std::size_t capacity, const bool usedAsBuffer) noexcept
 {
     const auto totalCapacity = capacity + usedAsBuffer;
     auto data = _tailCache.buffer.data;
 
     if (_tailCache.buffer.capacity != totalCapacity)
-        data = Utils::AlignedAlloc<alignof(Type), Type>(sizeof(Type) * totalCapacity);
+        data = reinterpret_cast<Type *>(AllocPolicy::Allocate(sizeof(Type) * totalCapacity, alignof(Type)));
 
     if (_tailCache.buffer.data && _tailCache.buffer.data != data) {
         clear();
-        Utils::AlignedFree(_tailCache.buffer.data);
+        AllocPolicy::Deallocate(_tailCache.buffer.data, sizeof(Type) * _tailCache.buffer.capacity, alignof(Type));
     }
 
     _tailCache.buffer.capacity = totalCapacity;
@@ -0,0 +1,105 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unbounded SPSC Queue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    template<typename Type, std::size_t SegmentCapacity = 1024>
+    class SPSCUnboundedQueue;
+}
+
+/**
+ * @brief The unbounded SPSC queue is a lock-free queue that only supports a Single Producer and a Single Consumer
+ * Elements are stored in a linked list of fixed-size segments, live data is never reallocated
+ * Segments fully consumed are recycled by the producer, so the steady state does not allocate
+ *
+ * @tparam Type to be inserted
+ * @tparam SegmentCapacity Number of elements per segment (must be a power of 2)
+ */
+template<typename Type, std::size_t SegmentCapacity>
+class alignas_double_cacheline Core::SPSCUnboundedQueue
+{
+public:
+    static_assert(SegmentCapacity >= 2 && (SegmentCapacity & (SegmentCapacity - 1)) == 0,
+            "Core::SPSCUnboundedQueue: Segment capacity must be a power of 2");
+
+    /** @brief Fixed-size block of elements */
+    struct alignas_cacheline Segment
+    {
+        std::atomic<Segment *> next { nullptr };
+        alignas(Type) std::byte storage[sizeof(Type) * SegmentCapacity];
+
+        /** @brief Get the element storage */
+        [[nodiscard]] Type *data(void) noexcept { return reinterpret_cast<Type *>(storage); }
+    };
+
+    /** @brief Cache of the producer thread */
+    struct ProducerCache
+    {
+        Segment *segment { nullptr }; // Segment being filled
+        Segment *front { nullptr }; // Oldest segment of the list, recycled once consumed
+        std::size_t frontIndex { 0u }; // Global index of the first element of 'front'
+        std::size_t value { 0u }; // Cached head
+    };
+
+    /** @brief Cache of the consumer thread */
+    struct ConsumerCache
+    {
+        Segment *segment { nullptr }; // Segment being drained
+        std::size_t value { 0u }; // Cached tail
+    };
+
+    /** @brief Default constructor, allocate the first segment */
+    SPSCUnboundedQueue(void);
+
+    /** @brief Destruct and release all memory (unsafe) */
+    ~SPSCUnboundedQueue(void) noexcept_destructible(Type);
+
+    /** @brief Push a single element into the queue, a segment is allocated only if none can be recycled */
+    template<typename ...Args>
+    std::enable_if_t<std::is_constructible_v<Type, Args...>, void>
+            push(Args &&...args);
+
+    /** @brief Pop a single element from the queue
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool pop(Type &value)
+        noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type));
+
+    /** @brief Clear all elements of the queue (unsafe) */
+    void clear(void) noexcept_destructible(Type) { for (Type tmp; pop(tmp);); }
+
+    /** @brief Get the size of the queue */
+    [[nodiscard]] std::size_t size(void) const noexcept
+        { return _tail.load(std::memory_order_seq_cst) - _head.load(std::memory_order_seq_cst); }
+
+private:
+    alignas_cacheline std::atomic<std::size_t> _tail { 0u }; // Tail accessed by both producer and consumer
+    alignas_cacheline ProducerCache _tailCache {}; // Cache accessed by producer thread
+
+    alignas_cacheline std::atomic<std::size_t> _head { 0u }; // Head accessed by both producer and consumer
+    alignas_cacheline ConsumerCache _headCache {}; // Cache accessed by consumer thread
+
+    /** @brief Copy and move constructors disabled */
+    SPSCUnboundedQueue(const SPSCUnboundedQueue &other) = delete;
+    SPSCUnboundedQueue(SPSCUnboundedQueue &&other) = delete;
+
+    /** @brief Recycle the front segment if the consumer is done with it, else allocate a new one */
+    [[nodiscard]] Segment *acquireSegment(void);
+
+    /** @brief Allocate an empty segment */
+    [[nodiscard]] static Segment *AllocateSegment(void);
+};
+
+static_assert_sizeof(Core::SPSCUnboundedQueue<int>, 4 * Core::CacheLineSize);
+static_assert_alignof_double_cacheline(Core::SPSCUnboundedQueue<int>);
+
+#include "SPSCUnboundedQueue.ipp"
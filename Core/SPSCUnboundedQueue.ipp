@@ -0,0 +1,104 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unbounded SPSC Queue
+ */
+
+#include <stdexcept>
+
+template<typename Type, std::size_t SegmentCapacity>
+inline Core::SPSCUnboundedQueue<Type, SegmentCapacity>::SPSCUnboundedQueue(void)
+{
+    const auto segment = AllocateSegment();
+
+    _tailCache.segment = segment;
+    _tailCache.front = segment;
+    _headCache.segment = segment;
+}
+
+template<typename Type, std::size_t SegmentCapacity>
+inline Core::SPSCUnboundedQueue<Type, SegmentCapacity>::~SPSCUnboundedQueue(void) noexcept_destructible(Type)
+{
+    clear();
+    for (auto segment = _tailCache.front; segment;) {
+        const auto next = segment->next.load(std::memory_order_relaxed);
+        segment->~Segment();
+        Utils::AlignedFree(segment);
+        segment = next;
+    }
+}
+
+template<typename Type, std::size_t SegmentCapacity>
+template<typename ...Args>
+inline std::enable_if_t<std::is_constructible_v<Type, Args...>, void>
+        Core::SPSCUnboundedQueue<Type, SegmentCapacity>::push(Args &&...args)
+{
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    const auto offset = tail & (SegmentCapacity - 1);
+    auto segment = _tailCache.segment;
+
+    if (!offset && tail) {
+        // The current segment is full, the next one is published before the tail crosses the boundary
+        const auto next = acquireSegment();
+        segment->next.store(next, std::memory_order_release);
+        segment = _tailCache.segment = next;
+    }
+    new (segment->data() + offset) Type(std::forward<Args>(args)...);
+    _tail.store(tail + 1, std::memory_order_release);
+}
+
+template<typename Type, std::size_t SegmentCapacity>
+inline bool Core::SPSCUnboundedQueue<Type, SegmentCapacity>::pop(Type &value)
+    noexcept(nothrow_destructible(Type) && nothrow_forward_assignable(Type))
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+
+    if (auto tail = _headCache.value; head == tail) {
+        tail = _headCache.value = _tail.load(std::memory_order_acquire);
+        if (head == tail)
+            return false;
+    }
+    const auto offset = head & (SegmentCapacity - 1);
+    auto segment = _headCache.segment;
+    if (!offset && head)
+        segment = _headCache.segment = segment->next.load(std::memory_order_acquire);
+    auto * const elem = segment->data() + offset;
+    if constexpr (std::is_move_assignable_v<Type>)
+        value = std::move(*elem);
+    else
+        value = *elem;
+    elem->~Type();
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename Type, std::size_t SegmentCapacity>
+inline typename Core::SPSCUnboundedQueue<Type, SegmentCapacity>::Segment *
+        Core::SPSCUnboundedQueue<Type, SegmentCapacity>::acquireSegment(void)
+{
+    const auto front = _tailCache.front;
+    // The consumer left 'front' once it popped the first element of the following segment
+    const auto frontEnd = _tailCache.frontIndex + SegmentCapacity;
+
+    if (front != _tailCache.segment) {
+        if (_tailCache.value <= frontEnd)
+            _tailCache.value = _head.load(std::memory_order_acquire);
+        if (_tailCache.value > frontEnd) {
+            _tailCache.front = front->next.load(std::memory_order_relaxed);
+            _tailCache.frontIndex = frontEnd;
+            front->next.store(nullptr, std::memory_order_relaxed);
+            return front;
+        }
+    }
+    return AllocateSegment();
+}
+
+template<typename Type, std::size_t SegmentCapacity>
+inline typename Core::SPSCUnboundedQueue<Type, SegmentCapacity>::Segment *
+        Core::SPSCUnboundedQueue<Type, SegmentCapacity>::AllocateSegment(void)
+{
+    const auto segment = Utils::AlignedAlloc<alignof(Segment), Segment>(sizeof(Segment));
+
+    if (!segment)
+        throw std::runtime_error("Core::SPSCUnboundedQueue: Malloc failed");
+    return new (segment) Segment;
+}
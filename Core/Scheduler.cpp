@@ -0,0 +1,210 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Work-stealing task scheduler
+ */
+
+#include <exception>
+#include <stdexcept>
+
+#include "Assert.hpp"
+#include "Scheduler.hpp"
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Scheduler state of the calling thread */
+    struct ThreadContext
+    {
+        Scheduler *scheduler { nullptr }; // Scheduler owning the thread, if it is a worker
+        std::uint32_t index { 0u }; // Worker index
+        Scheduler::Task *task { nullptr }; // Task being executed
+        std::uint64_t seed { 0x9E3779B97F4A7C15ull }; // Victim selection state
+    };
+
+    thread_local ThreadContext Context {};
+
+    /** @brief Xorshift random generator used to select victims */
+    [[nodiscard]] inline std::uint64_t XorShift(std::uint64_t &state) noexcept
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+}
+
+Scheduler::Scheduler(const std::size_t workerCount, const std::size_t queueCapacity)
+    : _injection(queueCapacity), _externalPool(queueCapacity)
+{
+    if (!workerCount)
+        throw std::invalid_argument("Core::Scheduler: Worker count must be > 0");
+    const auto poolCount = workerCount + 1;
+    if (_tasks = Utils::AlignedAlloc<alignof(Task), Task>(sizeof(Task) * poolCount * queueCapacity); !_tasks)
+        throw std::runtime_error("Core::Scheduler: Malloc failed");
+    _workers.reserve(static_cast<std::uint32_t>(workerCount));
+    for (auto i = 0ul; i < workerCount; ++i)
+        _workers.push(std::make_unique<Worker>(queueCapacity));
+    for (auto pool = 0ul; pool < poolCount; ++pool) {
+        auto &queue = pool < workerCount ? _workers[static_cast<std::uint32_t>(pool)]->pool : _externalPool;
+        for (auto i = 0ul; i < queueCapacity; ++i) {
+            const auto task = new (&_tasks[pool * queueCapacity + i]) Task;
+            task->pool = static_cast<std::uint32_t>(pool);
+            [[maybe_unused]] const bool pushed = queue.push(task);
+            coreAssert(pushed, std::terminate());
+        }
+    }
+    for (auto i = 0u; i < _workers.size(); ++i)
+        _workers[i]->thread = std::thread(&Scheduler::workerMain, this, i);
+}
+
+Scheduler::~Scheduler(void)
+{
+    _running.store(false, std::memory_order_release);
+    _idle.notifyAll();
+    for (auto &worker : _workers)
+        worker->thread.join();
+    // Tasks submitted while workers were stopping
+    while (const auto task = findTask())
+        execute(task);
+    for (auto &worker : _workers) {
+        for (Task *task; worker->pool.pop(task);)
+            task->~Task();
+    }
+    for (Task *task; _externalPool.pop(task);)
+        task->~Task();
+    Utils::AlignedFree(_tasks);
+}
+
+void Scheduler::submit(Task * const task)
+{
+    // Workers fallback to the injection queue when their deque is full
+    const bool pushed = (Context.scheduler == this && _workers[Context.index]->deque.push(task)) || _injection.push(task);
+
+    if (!pushed) {
+        // Queues are full, execute the task in place
+        execute(task);
+        return;
+    }
+    // Concurrent submits can't tell which one made the queue non-empty, so each one wakes a worker
+    // Notifying is cheap when no worker is parked
+    _idle.notifyOne();
+}
+
+void Scheduler::wait(Task * const task)
+{
+    while (task->pending.load(std::memory_order_acquire)) {
+        if (const auto other = findTask())
+            execute(other);
+        else
+            std::this_thread::yield();
+    }
+    unreference(task);
+}
+
+void Scheduler::release(Task * const task) noexcept
+{
+    unreference(task);
+}
+
+Scheduler::Task *Scheduler::CurrentTask(void) noexcept
+{
+    return Context.task;
+}
+
+void Scheduler::workerMain(const std::uint32_t index)
+{
+    Context.scheduler = this;
+    Context.index = index;
+    Context.seed += index;
+    while (true) {
+        Task *task = findTask();
+        if (!task) {
+            _idle.wait([this, &task] {
+                task = findTask();
+                return task || !_running.load(std::memory_order_acquire);
+            });
+            if (!task)
+                break;
+            // There may be more work left, let another worker look for it
+            _idle.notifyOne();
+        }
+        execute(task);
+    }
+    Context = ThreadContext {};
+}
+
+Scheduler::Task *Scheduler::findTask(void) noexcept
+{
+    const bool isWorker = Context.scheduler == this;
+    const auto count = _workers.size();
+    Task *task = nullptr;
+
+    if (isWorker && _workers[Context.index]->deque.pop(task))
+        return task;
+    else if (_injection.pop(task))
+        return task;
+    auto victim = static_cast<std::uint32_t>(XorShift(Context.seed) % count);
+    for (auto i = 0u; i < count; ++i, victim = victim + 1 == count ? 0u : victim + 1) {
+        if (isWorker && victim == Context.index)
+            continue;
+        else if (_workers[victim]->deque.steal(task))
+            return task;
+    }
+    return nullptr;
+}
+
+void Scheduler::execute(Task * const task)
+{
+    const auto previous = Context.task;
+
+    Context.task = task;
+    task->work();
+    Context.task = previous;
+    complete(task);
+}
+
+void Scheduler::complete(Task *task) noexcept
+{
+    while (task) {
+        if (task->pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+        const auto parent = task->parent;
+        unreference(task);
+        task = parent;
+    }
+}
+
+Scheduler::Task *Scheduler::allocate(Task * const parent, const std::uint32_t references)
+{
+    auto &pool = Context.scheduler == this ? _workers[Context.index]->pool : _externalPool;
+    Task *task = nullptr;
+
+    if (!pool.pop(task)) {
+        // Pool is exhausted, fallback to the heap
+        if (task = Utils::AlignedAlloc<alignof(Task), Task>(sizeof(Task)); !task)
+            throw std::runtime_error("Core::Scheduler: Malloc failed");
+        new (task) Task;
+    }
+    task->parent = parent;
+    task->pending.store(1u, std::memory_order_relaxed);
+    task->references.store(references, std::memory_order_relaxed);
+    if (parent)
+        parent->pending.fetch_add(1u, std::memory_order_relaxed);
+    return task;
+}
+
+void Scheduler::unreference(Task * const task) noexcept
+{
+    if (task->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+    task->work = Work();
+    if (task->pool == HeapPool) {
+        task->~Task();
+        Utils::AlignedFree(task);
+        return;
+    }
+    auto &pool = task->pool < _workers.size() ? _workers[task->pool]->pool : _externalPool;
+    [[maybe_unused]] const bool pushed = pool.push(task);
+    coreAssert(pushed, std::terminate());
+}
@@ -0,0 +1,125 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Work-stealing task scheduler
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "Functor.hpp"
+#include "MPMCQueue.hpp"
+#include "Vector.hpp"
+#include "WaitPolicy.hpp"
+#include "WorkStealingDeque.hpp"
+
+namespace Core
+{
+    class Scheduler;
+}
+
+/**
+ * @brief Work-stealing task scheduler
+ * Each worker owns a Chase-Lev deque where it pushes and pops its tasks, idle workers steal from random victims
+ * Tasks submitted from outside of the workers go through a global injection queue
+ * A task may have a parent, which only completes once all its children completed
+ */
+class Core::Scheduler
+{
+public:
+    /** @brief Work functor of a task */
+    using Work = Functor<void(void), CacheLineQuarterSize + CacheLineEighthSize>;
+
+    /** @brief Task pool index of heap allocated tasks */
+    static constexpr std::uint32_t HeapPool = ~static_cast<std::uint32_t>(0);
+
+    /** @brief A task fits a cacheline, its functor is stored inline */
+    struct alignas_cacheline Task
+    {
+        Work work {};
+        Task *parent { nullptr };
+        std::atomic<std::uint32_t> pending { 0u }; // Own work + unfinished children
+        std::atomic<std::uint32_t> references { 0u }; // Completion reference + handle reference
+        std::uint32_t pool { HeapPool }; // Pool the task returns to once released
+    };
+
+    /** @brief Construct the scheduler and start 'workerCount' workers
+     *  Each worker has a local deque of 'queueCapacity' tasks and a pool of 'queueCapacity' preallocated tasks (power of 2) */
+    Scheduler(const std::size_t workerCount = std::thread::hardware_concurrency(), const std::size_t queueCapacity = 4096);
+
+    /** @brief Execute all remaining tasks then join the workers */
+    ~Scheduler(void);
+
+    /** @brief Get the number of workers */
+    [[nodiscard]] std::size_t workerCount(void) const noexcept { return _workers.size(); }
+
+    /** @brief Create a task without submitting it
+     *  The returned handle must be released by either 'wait' or 'release' */
+    template<typename Functor>
+    [[nodiscard]] Task *create(Functor &&functor, Task * const parent = nullptr)
+        { return prepare(allocate(parent, 2u), std::forward<Functor>(functor)); }
+
+    /** @brief Submit a created task to the scheduler */
+    void submit(Task * const task);
+
+    /** @brief Create and submit a task without handle (fire and forget) */
+    template<typename Functor>
+    void dispatch(Functor &&functor, Task * const parent = nullptr)
+        { submit(prepare(allocate(parent, 1u), std::forward<Functor>(functor))); }
+
+    /** @brief Wait until a task and all its children completed, executing other tasks in the meantime
+     *  The task handle is released */
+    void wait(Task * const task);
+
+    /** @brief Release a task handle without waiting */
+    void release(Task * const task) noexcept;
+
+    /** @brief Get the task being executed by the calling thread, if any */
+    [[nodiscard]] static Task *CurrentTask(void) noexcept;
+
+private:
+    /** @brief Worker data, owned by a single thread */
+    struct alignas_double_cacheline Worker
+    {
+        WorkStealingDeque<Task *> deque;
+        MPMCQueue<Task *> pool;
+        std::thread thread {};
+
+        Worker(const std::size_t queueCapacity) : deque(queueCapacity), pool(queueCapacity) {}
+    };
+
+    Vector<std::unique_ptr<Worker>> _workers {};
+    MPMCQueue<Task *> _injection;
+    MPMCQueue<Task *> _externalPool;
+    Task *_tasks { nullptr };
+    std::atomic<bool> _running { true };
+    SpinParkWaitPolicy<> _idle {};
+
+    /** @brief Worker thread loop */
+    void workerMain(const std::uint32_t index);
+
+    /** @brief Find a task to execute: local deque, injection queue then random victims */
+    [[nodiscard]] Task *findTask(void) noexcept;
+
+    /** @brief Execute a task and complete it */
+    void execute(Task * const task);
+
+    /** @brief Decrement the pending counter of a task and propagate its completion to its parents */
+    void complete(Task *task) noexcept;
+
+    /** @brief Allocate a task from the pool of the calling thread */
+    [[nodiscard]] Task *allocate(Task * const parent, const std::uint32_t references);
+
+    /** @brief Drop a reference of a task and return it to its pool once unreferenced */
+    void unreference(Task * const task) noexcept;
+
+    /** @brief Set the work of a task */
+    template<typename Functor>
+    [[nodiscard]] static Task *prepare(Task * const task, Functor &&functor)
+        noexcept_forward_constructible(decltype(functor))
+        { task->work = std::forward<Functor>(functor); return task; }
+};
+
+static_assert_fit_cacheline(Core::Scheduler::Task);
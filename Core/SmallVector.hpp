@@ -16,11 +16,12 @@ namespace Core
      * @tparam Type Internal type in container
      * @tparam OptimizedCapacity Count of element in the optimized cache
      * @tparam Range Range of container
+     * @tparam GrowthPolicy Policy computing the capacity when the vector runs out of memory
      */
-    template<typename Type, std::size_t OptimizedCapacity, typename Range = std::size_t>
-    using SmallVector = Internal::VectorDetails<Internal::SmallVectorBase<Type, OptimizedCapacity, Range>, Type, Range, true>;
+    template<typename Type, std::size_t OptimizedCapacity, typename Range = std::size_t, typename GrowthPolicy = DoubleGrowthPolicy>
+    using SmallVector = Internal::VectorDetails<Internal::SmallVectorBase<Type, OptimizedCapacity, Range>, Type, Range, true, GrowthPolicy>;
 
     /** @brief Small optimized vector with a reduced range */
-    template<typename Type, std::size_t OptimizedCapacity>
-    using TinySmallVector = SmallVector<Type, OptimizedCapacity, std::uint32_t>;
+    template<typename Type, std::size_t OptimizedCapacity, typename GrowthPolicy = DoubleGrowthPolicy>
+    using TinySmallVector = SmallVector<Type, OptimizedCapacity, std::uint32_t, GrowthPolicy>;
 }
@@ -90,6 +90,13 @@ protected:
     /** @brief Deallocates a buffer */
     void deallocate(Type * const data, const Range capacity) noexcept;
 
+    /** @brief Allocates a temporary buffer, used by algorithms requiring scratch memory */
+    [[nodiscard]] static Type *allocateScratch(const Range count) noexcept
+        { return reinterpret_cast<Type *>(Utils::AlignedAlloc<alignof(Type)>(sizeof(Type) * count)); }
+
+    /** @brief Deallocates a temporary buffer */
+    static void deallocateScratch(Type * const data, const Range) noexcept { Utils::AlignedFree(data); }
+
     /** @brief Get a pointer to the data cache */
     [[nodiscard]] Type *optimizedData(void) noexcept
         { return reinterpret_cast<Type *>(&_optimizedData); }
@@ -0,0 +1,24 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Structure of arrays vector
+ */
+
+#pragma once
+
+#include "SoAVectorDetails.hpp"
+
+namespace Core
+{
+    /**
+     * @brief Vector storing each field of its elements in a separate array
+     * With default range (std::size_t), the vector takes 16 bytes plus a pointer per field
+     *
+     * @tparam Fields Type of each field
+     */
+    template<typename ...Fields>
+    using SoAVector = Internal::SoAVectorDetails<std::size_t, DoubleGrowthPolicy, Fields...>;
+
+    /** @brief Structure of arrays vector with a reduced range */
+    template<typename ...Fields>
+    using TinySoAVector = Internal::SoAVectorDetails<std::uint32_t, DoubleGrowthPolicy, Fields...>;
+}
@@ -0,0 +1,175 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SoAVectorDetails
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <span>
+#include <tuple>
+
+#include "Assert.hpp"
+#include "GrowthPolicy.hpp"
+#include "Utils.hpp"
+
+namespace Core::Internal
+{
+    template<typename Range, typename GrowthPolicy, typename ...Fields>
+    class SoAVectorDetails;
+}
+
+/**
+ * @brief Structure of arrays vector, each field is stored in its own cacheline aligned array
+ *  All arrays share the same size and capacity and live in a single allocation
+ *  Elements are accessed through tuples of references, fields through spans for vectorized loops
+ *
+ * @tparam Range Range of container
+ * @tparam GrowthPolicy Policy computing the capacity when the vector runs out of memory
+ * @tparam Fields Type of each field
+ */
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+class Core::Internal::SoAVectorDetails
+{
+public:
+    static_assert(sizeof...(Fields) > 0, "Core::SoAVector: At least one field is required");
+    static_assert(((alignof(Fields) <= CacheLineSize) && ...), "Core::SoAVector: Fields can't be aligned over a cacheline");
+
+    /** @brief Number of fields */
+    static constexpr std::size_t FieldCount = sizeof...(Fields);
+
+    /** @brief Type of a field */
+    template<std::size_t Index>
+    using FieldType = std::tuple_element_t<Index, std::tuple<Fields...>>;
+
+    /** @brief Tuple of references to the fields of an element */
+    using Reference = std::tuple<Fields &...>;
+    using ConstReference = std::tuple<const Fields &...>;
+
+    /** @brief Default constructor */
+    SoAVectorDetails(void) noexcept = default;
+
+    /** @brief Resize with default constructor */
+    SoAVectorDetails(const Range count) noexcept((nothrow_default_constructible(Fields) && ...))
+        { resize(count); }
+
+    /** @brief Copy constructor */
+    SoAVectorDetails(const SoAVectorDetails &other) noexcept((nothrow_copy_constructible(Fields) && ...));
+
+    /** @brief Move constructor */
+    SoAVectorDetails(SoAVectorDetails &&other) noexcept { swap(other); }
+
+    /** @brief Release the vector */
+    ~SoAVectorDetails(void) noexcept((nothrow_destructible(Fields) && ...)) { release(); }
+
+    /** @brief Copy assignment */
+    SoAVectorDetails &operator=(const SoAVectorDetails &other) noexcept((nothrow_copy_constructible(Fields) && ...))
+        { if (this != &other) { SoAVectorDetails tmp(other); swap(tmp); } return *this; }
+
+    /** @brief Move assignment */
+    SoAVectorDetails &operator=(SoAVectorDetails &&other) noexcept((nothrow_destructible(Fields) && ...))
+        { release(); swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(SoAVectorDetails &other) noexcept
+        { std::swap(_fields, other._fields); std::swap(_size, other._size); std::swap(_capacity, other._capacity); }
+
+
+    /** @brief Fast non-empty check */
+    [[nodiscard]] operator bool(void) const noexcept { return _size; }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Get the number of elements */
+    [[nodiscard]] Range size(void) const noexcept { return _size; }
+
+    /** @brief Get the number of elements that can be stored without growing */
+    [[nodiscard]] Range capacity(void) const noexcept { return _capacity; }
+
+
+    /** @brief Get the array of a field, aligned on a cacheline */
+    template<std::size_t Index>
+    [[nodiscard]] FieldType<Index> *data(void) noexcept { return std::get<Index>(_fields); }
+    template<std::size_t Index>
+    [[nodiscard]] const FieldType<Index> *data(void) const noexcept { return std::get<Index>(_fields); }
+
+    /** @brief Get the elements of a field */
+    template<std::size_t Index>
+    [[nodiscard]] std::span<FieldType<Index>> get(void) noexcept { return std::span<FieldType<Index>>(data<Index>(), _size); }
+    template<std::size_t Index>
+    [[nodiscard]] std::span<const FieldType<Index>> get(void) const noexcept { return std::span<const FieldType<Index>>(data<Index>(), _size); }
+
+
+    /** @brief Access the fields of the element at position */
+    [[nodiscard]] Reference at(const Range pos) noexcept_ndebug;
+    [[nodiscard]] ConstReference at(const Range pos) const noexcept_ndebug;
+    [[nodiscard]] Reference operator[](const Range pos) noexcept_ndebug { return at(pos); }
+    [[nodiscard]] ConstReference operator[](const Range pos) const noexcept_ndebug { return at(pos); }
+
+    /** @brief Get the first element */
+    [[nodiscard]] Reference front(void) noexcept_ndebug { return at(0); }
+    [[nodiscard]] ConstReference front(void) const noexcept_ndebug { return at(0); }
+
+    /** @brief Get the last element */
+    [[nodiscard]] Reference back(void) noexcept_ndebug { return at(_size - 1); }
+    [[nodiscard]] ConstReference back(void) const noexcept_ndebug { return at(_size - 1); }
+
+
+    /** @brief Push an element, each argument constructs its field */
+    template<typename ...Args>
+    std::enable_if_t<sizeof...(Args) == FieldCount, Reference> push(Args &&...args)
+        noexcept((nothrow_constructible(Fields, Args) && ...) && (nothrow_move_constructible(Fields) && ...));
+
+    /** @brief Pop the last element */
+    void pop(void) noexcept(nothrow_ndebug && (nothrow_destructible(Fields) && ...));
+
+    /** @brief Remove the element at position, the following elements are shifted */
+    void erase(const Range pos) noexcept(nothrow_ndebug && (nothrow_move_assignable(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+
+    /** @brief Resize the vector using default constructor to initialize each new field */
+    void resize(const Range count)
+        noexcept((nothrow_default_constructible(Fields) && ...) && (nothrow_move_constructible(Fields) && ...));
+
+    /** @brief Destroy all elements */
+    void clear(void) noexcept((nothrow_destructible(Fields) && ...));
+
+    /** @brief Destroy all elements and release the buffer */
+    void release(void) noexcept((nothrow_destructible(Fields) && ...));
+
+    /** @brief Reserve memory only if asked capacity is higher than current capacity
+     *  @return True if the reserve happened and the data has been moved */
+    bool reserve(const Range capacity) noexcept((nothrow_move_constructible(Fields) && ...));
+
+    /** @brief Grow internal buffers of at least a given minimum, the new capacity is computed by the growth policy */
+    void grow(const Range minimum = Range()) noexcept((nothrow_move_constructible(Fields) && ...));
+
+private:
+    std::tuple<Fields *...> _fields {};
+    Range _size {};
+    Range _capacity {};
+
+    /** @brief Get the byte offset of each array and the total size of an allocation of 'capacity' elements */
+    [[nodiscard]] static std::array<std::size_t, FieldCount + 1> Layout(const Range capacity) noexcept;
+
+    /** @brief Get the arrays of an allocation from its layout */
+    template<std::size_t ...Indexes>
+    [[nodiscard]] static std::tuple<Fields *...> Split(
+            std::byte * const buffer, const std::array<std::size_t, FieldCount + 1> &layout, std::index_sequence<Indexes...>) noexcept;
+
+    /** @brief Relocate all elements to a new allocation of 'capacity' elements */
+    void reallocate(const Range capacity) noexcept((nothrow_move_constructible(Fields) && ...));
+
+    /** @brief Relocate every field array to another set of arrays */
+    template<std::size_t ...Indexes>
+    void relocateFields(const std::tuple<Fields *...> &to, std::index_sequence<Indexes...>) noexcept((nothrow_move_constructible(Fields) && ...));
+
+    /** @brief Copy every field array of another vector, the capacity must be large enough
+     *  If a copy throws, the fields copied so far are destroyed and the buffer is released */
+    template<std::size_t ...Indexes>
+    void copyFields(const SoAVectorDetails &other, std::index_sequence<Indexes...>) noexcept((nothrow_copy_constructible(Fields) && ...));
+};
+
+#include "SoAVectorDetails.ipp"
@@ -0,0 +1,180 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SoAVectorDetails
+ */
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::SoAVectorDetails(const SoAVectorDetails &other)
+    noexcept((nothrow_copy_constructible(Fields) && ...))
+{
+    if (!other._size)
+        return;
+    reallocate(other._size);
+    copyFields(other, std::index_sequence_for<Fields...>());
+    _size = other._size;
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline typename Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::Reference
+    Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::at(const Range pos) noexcept_ndebug
+{
+    coreAssert(pos < _size,
+        throw std::out_of_range("Core::SoAVector::at: Position out of range"));
+    return std::apply([pos](Fields * const ...fields) { return Reference(fields[pos]...); }, _fields);
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline typename Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::ConstReference
+    Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::at(const Range pos) const noexcept_ndebug
+{
+    coreAssert(pos < _size,
+        throw std::out_of_range("Core::SoAVector::at: Position out of range"));
+    return std::apply([pos](const Fields * const ...fields) { return ConstReference(fields[pos]...); }, _fields);
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+template<typename ...Args>
+inline std::enable_if_t<sizeof...(Args) == Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::FieldCount, typename Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::Reference>
+    Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::push(Args &&...args)
+        noexcept((nothrow_constructible(Fields, Args) && ...) && (nothrow_move_constructible(Fields) && ...))
+{
+    if (_size == _capacity)
+        grow();
+    const auto pos = _size;
+    std::apply([pos, &args...](Fields * const ...fields) { (new (fields + pos) Fields(std::forward<Args>(args)), ...); }, _fields);
+    _size = static_cast<Range>(pos + 1);
+    return at(pos);
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::pop(void) noexcept(nothrow_ndebug && (nothrow_destructible(Fields) && ...))
+{
+    coreAssert(_size,
+        throw std::out_of_range("Core::SoAVector::pop: Vector is empty"));
+    _size = static_cast<Range>(_size - 1);
+    std::apply([this](Fields * const ...fields) { (std::destroy_at(fields + _size), ...); }, _fields);
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::erase(const Range pos)
+    noexcept(nothrow_ndebug && (nothrow_move_assignable(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    coreAssert(pos < _size,
+        throw std::out_of_range("Core::SoAVector::erase: Position out of range"));
+    std::apply([this, pos](Fields * const ...fields) { (std::move(fields + pos + 1, fields + _size, fields + pos), ...); }, _fields);
+    pop();
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::resize(const Range count)
+    noexcept((nothrow_default_constructible(Fields) && ...) && (nothrow_move_constructible(Fields) && ...))
+{
+    if (count > _size) {
+        reserve(count);
+        std::apply([this, count](Fields * const ...fields) { (std::uninitialized_value_construct(fields + _size, fields + count), ...); }, _fields);
+    } else
+        std::apply([this, count](Fields * const ...fields) { (std::destroy(fields + count, fields + _size), ...); }, _fields);
+    _size = count;
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::clear(void) noexcept((nothrow_destructible(Fields) && ...))
+{
+    std::apply([this](Fields * const ...fields) { (std::destroy_n(fields, _size), ...); }, _fields);
+    _size = Range();
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::release(void) noexcept((nothrow_destructible(Fields) && ...))
+{
+    if (!_capacity)
+        return;
+    clear();
+    // The first array is the beginning of the allocation
+    Utils::AlignedFree(std::get<0>(_fields));
+    _fields = std::tuple<Fields *...>();
+    _capacity = Range();
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline bool Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::reserve(const Range capacity)
+    noexcept((nothrow_move_constructible(Fields) && ...))
+{
+    if (_capacity >= capacity)
+        return false;
+    reallocate(capacity);
+    return true;
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::grow(const Range minimum)
+    noexcept((nothrow_move_constructible(Fields) && ...))
+{
+    // The growth policy sees an element as the sum of its fields
+    reallocate(GrowthPolicy::template NextCapacity<std::tuple<Fields...>, Range>(_capacity, minimum));
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline std::array<std::size_t, Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::FieldCount + 1>
+    Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::Layout(const Range capacity) noexcept
+{
+    constexpr std::size_t Sizes[] = { sizeof(Fields)... };
+    std::array<std::size_t, FieldCount + 1> layout {};
+    std::size_t offset = 0ul;
+
+    for (auto i = 0ul; i < FieldCount; ++i) {
+        layout[i] = offset;
+        offset += (Sizes[i] * static_cast<std::size_t>(capacity) + CacheLineSize - 1ul) & ~(CacheLineSize - 1ul);
+    }
+    layout[FieldCount] = offset;
+    return layout;
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::reallocate(const Range capacity)
+    noexcept((nothrow_move_constructible(Fields) && ...))
+{
+    const auto layout = Layout(capacity);
+    const auto buffer = Utils::AlignedAlloc<CacheLineSize, std::byte>(layout[FieldCount]);
+    const auto fields = Split(buffer, layout, std::index_sequence_for<Fields...>());
+
+    if (_capacity) {
+        relocateFields(fields, std::index_sequence_for<Fields...>());
+        Utils::AlignedFree(std::get<0>(_fields));
+    }
+    _fields = fields;
+    _capacity = capacity;
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+template<std::size_t ...Indexes>
+inline std::tuple<Fields *...> Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::Split(
+        std::byte * const buffer, const std::array<std::size_t, FieldCount + 1> &layout, std::index_sequence<Indexes...>) noexcept
+{
+    return std::tuple<Fields *...>(reinterpret_cast<Fields *>(buffer + layout[Indexes])...);
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+template<std::size_t ...Indexes>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::relocateFields(
+        const std::tuple<Fields *...> &to, std::index_sequence<Indexes...>) noexcept((nothrow_move_constructible(Fields) && ...))
+{
+    (Utils::RelocateN(std::get<Indexes>(_fields), _size, std::get<Indexes>(to)), ...);
+}
+
+template<typename Range, typename GrowthPolicy, typename ...Fields>
+template<std::size_t ...Indexes>
+inline void Core::Internal::SoAVectorDetails<Range, GrowthPolicy, Fields...>::copyFields(
+        const SoAVectorDetails &other, std::index_sequence<Indexes...>) noexcept((nothrow_copy_constructible(Fields) && ...))
+{
+    std::size_t copied = 0ul;
+
+    try {
+        ((std::uninitialized_copy_n(std::get<Indexes>(other._fields), other._size, std::get<Indexes>(_fields)), ++copied), ...);
+    } catch (...) {
+        // The vector is still empty, only the copied fields need to be destroyed
+        ((Indexes < copied ? static_cast<void>(std::destroy_n(std::get<Indexes>(_fields), other._size)) : static_cast<void>(0)), ...);
+        release();
+        throw;
+    }
+}
@@ -0,0 +1,28 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Sorted flat map
+ */
+
+#pragma once
+
+#include "SortedFlatMapDetails.hpp"
+#include "Vector.hpp"
+
+namespace Core
+{
+    /**
+     * @brief Sorted map storing its keys and values in two parallel vectors
+     * With default range (std::size_t), the map takes 48 bytes
+     *
+     * @tparam Key Key type
+     * @tparam Value Mapped type
+     * @tparam Range Range of container
+     * @tparam Compare Compare operator of the keys
+     */
+    template<typename Key, typename Value, typename Range = std::size_t, typename Compare = KeyLess>
+    using SortedFlatMap = Internal::SortedFlatMapDetails<Key, Value, Range, Compare, Vector<Key, Range>, Vector<Value, Range>>;
+
+    /** @brief 32 bytes sorted flat map with a reduced range */
+    template<typename Key, typename Value, typename Compare = KeyLess>
+    using SortedTinyFlatMap = SortedFlatMap<Key, Value, std::uint32_t, Compare>;
+}
@@ -0,0 +1,288 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SortedFlatMapDetails
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include "Assert.hpp"
+#include "Hash.hpp"
+#include "Utils.hpp"
+
+namespace Core
+{
+    /** @brief Transparent ordering functor of the sorted maps
+     *  Strings (std or Core, views and cstrings) are ordered by characters so any of them can be used to lookup another */
+    struct KeyLess;
+
+    namespace Internal
+    {
+        template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+        class SortedFlatMapDetails;
+    }
+}
+
+struct Core::KeyLess
+{
+    /** @brief Tell std containers that any key type can be compared */
+    using is_transparent = void;
+
+    /** @brief Compare two keys of any supported type */
+    template<typename Left, typename Right>
+    [[nodiscard]] constexpr bool operator()(const Left &left, const Right &right) const noexcept
+    {
+        if constexpr (IsString<Left> && IsString<Right>)
+            return ToView(left) < ToView(right);
+        else
+            return left < right;
+    }
+
+private:
+    /** @brief Check if a type can be viewed as a std::string_view */
+    template<typename Type>
+    static constexpr bool IsString = std::is_convertible_v<const Type &, std::string_view> || Utils::IsDetected<Hasher::StdViewDetector, Type>;
+
+    /** @brief View a string key */
+    template<typename Type>
+    [[nodiscard]] static constexpr std::string_view ToView(const Type &value) noexcept
+    {
+        if constexpr (std::is_convertible_v<const Type &, std::string_view>)
+            return std::string_view(value);
+        else
+            return value.toStdView();
+    }
+};
+
+/**
+ * @brief Sorted map storing its keys and values in two parallel vectors
+ *  Searches only walk the dense key vector, the values are touched once the key is found
+ *  Lookups are heterogeneous when Compare is transparent
+ *
+ * @tparam Key Key type
+ * @tparam Value Mapped type
+ * @tparam Range Range of the vectors
+ * @tparam Compare Ordering of the keys
+ * @tparam KeyVector Vector storing the keys
+ * @tparam ValueVector Vector storing the values
+ */
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+class Core::Internal::SortedFlatMapDetails
+{
+public:
+    /** @brief Iterator over both vectors at once */
+    template<bool IsConst>
+    class IteratorBase
+    {
+    public:
+        /** @brief Value pointer of the iterator */
+        using ValuePointer = std::conditional_t<IsConst, const Value *, Value *>;
+
+        /** @brief Pair of references to a key and its value */
+        struct Reference
+        {
+            const Key &first;
+            std::remove_pointer_t<ValuePointer> &second;
+
+            /** @brief Arrow operator to support 'it->first' */
+            [[nodiscard]] const Reference *operator->(void) const noexcept { return this; }
+        };
+
+        /** @brief Iterator traits */
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Reference;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Reference;
+        using reference = Reference;
+
+        /** @brief Default constructor */
+        IteratorBase(void) noexcept = default;
+
+        /** @brief Construct an iterator from its key and value */
+        IteratorBase(const Key * const key, const ValuePointer value) noexcept : _key(key), _value(value) {}
+
+        /** @brief Conversion to a constant iterator */
+        operator IteratorBase<true>(void) const noexcept { return IteratorBase<true>(_key, _value); }
+
+        /** @brief Access operators */
+        [[nodiscard]] Reference operator*(void) const noexcept { return Reference { *_key, *_value }; }
+        [[nodiscard]] Reference operator->(void) const noexcept { return **this; }
+
+        /** @brief Increment / decrement operators */
+        IteratorBase &operator++(void) noexcept { ++_key; ++_value; return *this; }
+        IteratorBase operator++(int) noexcept { auto tmp = *this; ++*this; return tmp; }
+        IteratorBase &operator--(void) noexcept { --_key; --_value; return *this; }
+        IteratorBase operator--(int) noexcept { auto tmp = *this; --*this; return tmp; }
+
+        /** @brief Comparison operators */
+        [[nodiscard]] bool operator==(const IteratorBase &other) const noexcept { return _key == other._key; }
+        [[nodiscard]] bool operator!=(const IteratorBase &other) const noexcept { return _key != other._key; }
+
+    private:
+        const Key *_key { nullptr };
+        ValuePointer _value { nullptr };
+
+        friend class SortedFlatMapDetails;
+    };
+
+    /** @brief Iterators, the keys are constant */
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    /** @brief Default constructor */
+    SortedFlatMapDetails(void) noexcept = default;
+
+    /** @brief Copy constructor */
+    SortedFlatMapDetails(const SortedFlatMapDetails &other) = default;
+
+    /** @brief Move constructor */
+    SortedFlatMapDetails(SortedFlatMapDetails &&other) noexcept = default;
+
+    /** @brief Initializer list constructor */
+    SortedFlatMapDetails(std::initializer_list<std::pair<Key, Value>> &&init);
+
+    /** @brief Release the map */
+    ~SortedFlatMapDetails(void) noexcept(nothrow_destructible(Key) && nothrow_destructible(Value)) = default;
+
+    /** @brief Copy assignment */
+    SortedFlatMapDetails &operator=(const SortedFlatMapDetails &other) = default;
+
+    /** @brief Move assignment */
+    SortedFlatMapDetails &operator=(SortedFlatMapDetails &&other) noexcept = default;
+
+    /** @brief Swap two instances */
+    void swap(SortedFlatMapDetails &other) noexcept { _keys.swap(other._keys); _values.swap(other._values); }
+
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return _keys.empty(); }
+
+    /** @brief Get the number of elements */
+    [[nodiscard]] Range size(void) const noexcept { return _keys.size(); }
+
+    /** @brief Get the number of elements that can be stored without growing */
+    [[nodiscard]] Range capacity(void) const noexcept { return _keys.capacity(); }
+
+    /** @brief Get the sorted keys */
+    [[nodiscard]] const KeyVector &keys(void) const noexcept { return _keys; }
+
+    /** @brief Get the values, in the order of their keys (their count must not be changed) */
+    [[nodiscard]] ValueVector &values(void) noexcept { return _values; }
+    [[nodiscard]] const ValueVector &values(void) const noexcept { return _values; }
+
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] Iterator begin(void) noexcept { return iteratorAt(0); }
+    [[nodiscard]] Iterator end(void) noexcept { return iteratorAt(size()); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return iteratorAt(0); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return iteratorAt(size()); }
+
+
+    /** @brief Find the first element whose key is not ordered before 'key' */
+    template<typename Lookup>
+    [[nodiscard]] Iterator lowerBound(const Lookup &key) noexcept_invocable(Compare, const Key &, const Lookup &)
+        { return iteratorAt(lowerBoundIndex(key)); }
+    template<typename Lookup>
+    [[nodiscard]] ConstIterator lowerBound(const Lookup &key) const noexcept_invocable(Compare, const Key &, const Lookup &)
+        { return iteratorAt(lowerBoundIndex(key)); }
+
+    /** @brief Find an element using any key type supported by Compare
+     *  @return end() if the key is not found */
+    template<typename Lookup>
+    [[nodiscard]] Iterator find(const Lookup &key)
+        noexcept(nothrow_invocable(Compare, const Key &, const Lookup &) && nothrow_invocable(Compare, const Lookup &, const Key &))
+        { return iteratorAt(findIndex(key)); }
+    template<typename Lookup>
+    [[nodiscard]] ConstIterator find(const Lookup &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const Lookup &) && nothrow_invocable(Compare, const Lookup &, const Key &))
+        { return iteratorAt(findIndex(key)); }
+
+    /** @brief Check if the map contains a key */
+    template<typename Lookup>
+    [[nodiscard]] bool contains(const Lookup &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const Lookup &) && nothrow_invocable(Compare, const Lookup &, const Key &))
+        { return findIndex(key) != size(); }
+
+
+    /** @brief Insert a key if not present, the key is only constructed from 'key' on insertion
+     *  @return The element and true if inserted */
+    template<typename KeyArg, typename ...Args>
+    std::pair<Iterator, bool> tryEmplace(KeyArg &&key, Args &&...args);
+
+    /** @brief Insert a pair if its key is not present */
+    std::pair<Iterator, bool> insert(const std::pair<Key, Value> &pair)
+        { return tryEmplace(pair.first, pair.second); }
+    std::pair<Iterator, bool> insert(std::pair<Key, Value> &&pair)
+        { return tryEmplace(std::move(pair.first), std::move(pair.second)); }
+
+    /** @brief Insert or assign the value of a key
+     *  @return The element and true if inserted */
+    template<typename KeyArg, typename ValueArg>
+    std::pair<Iterator, bool> insertOrAssign(KeyArg &&key, ValueArg &&value);
+
+    /** @brief Access the value of a key, inserting a default constructed value if not present */
+    template<typename KeyArg>
+    [[nodiscard]] Value &operator[](KeyArg &&key)
+        { return tryEmplace(std::forward<KeyArg>(key)).first->second; }
+
+    /** @brief Access the value of an existing key */
+    template<typename Lookup>
+    [[nodiscard]] Value &at(const Lookup &key) noexcept_ndebug;
+    template<typename Lookup>
+    [[nodiscard]] const Value &at(const Lookup &key) const noexcept_ndebug;
+
+
+    /** @brief Erase a key if present
+     *  @return True if erased */
+    template<typename Lookup>
+    std::enable_if_t<!std::is_convertible_v<const Lookup &, ConstIterator>, bool> erase(const Lookup &key)
+        noexcept(nothrow_destructible(Key) && nothrow_destructible(Value));
+
+    /** @brief Erase an element
+     *  @return Iterator to the following element */
+    Iterator erase(const ConstIterator pos) noexcept(nothrow_destructible(Key) && nothrow_destructible(Value));
+
+
+    /** @brief Reserve memory for at least 'count' elements */
+    void reserve(const Range count) { _keys.reserve(count); _values.reserve(count); }
+
+    /** @brief Destroy all elements */
+    void clear(void) noexcept(nothrow_destructible(Key) && nothrow_destructible(Value)) { _keys.clear(); _values.clear(); }
+
+    /** @brief Destroy all elements and release memory */
+    void release(void) noexcept(nothrow_destructible(Key) && nothrow_destructible(Value)) { _keys.release(); _values.release(); }
+
+
+    /** @brief Comparison operators */
+    [[nodiscard]] bool operator==(const SortedFlatMapDetails &other) const noexcept
+        { return _keys == other._keys && _values == other._values; }
+    [[nodiscard]] bool operator!=(const SortedFlatMapDetails &other) const noexcept
+        { return !operator==(other); }
+
+private:
+    KeyVector _keys {};
+    ValueVector _values {};
+
+    /** @brief Get an iterator from an index */
+    [[nodiscard]] Iterator iteratorAt(const Range index) noexcept
+        { return Iterator(_keys.data() + index, _values.data() + index); }
+    [[nodiscard]] ConstIterator iteratorAt(const Range index) const noexcept
+        { return ConstIterator(_keys.data() + index, _values.data() + index); }
+
+    /** @brief Insert a key and its value at index
+     *  The vectors stay in sync if a constructor throws, as long as moving a key or a value doesn't */
+    template<typename KeyArg, typename ...Args>
+    void emplaceAt(const Range index, KeyArg &&key, Args &&...args);
+
+    /** @brief Find the index of the first key not ordered before 'key' */
+    template<typename Lookup>
+    [[nodiscard]] Range lowerBoundIndex(const Lookup &key) const noexcept_invocable(Compare, const Key &, const Lookup &);
+
+    /** @brief Find the index of a key, size() if not found */
+    template<typename Lookup>
+    [[nodiscard]] Range findIndex(const Lookup &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const Lookup &) && nothrow_invocable(Compare, const Lookup &, const Key &));
+};
+
+#include "SortedFlatMapDetails.ipp"
@@ -0,0 +1,124 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SortedFlatMapDetails
+ */
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+inline Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::SortedFlatMapDetails(
+        std::initializer_list<std::pair<Key, Value>> &&init)
+{
+    reserve(static_cast<Range>(init.size()));
+    for (const auto &pair : init)
+        insert(pair);
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+template<typename KeyArg, typename ...Args>
+inline std::pair<typename Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::Iterator, bool>
+    Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::tryEmplace(KeyArg &&key, Args &&...args)
+{
+    const auto index = lowerBoundIndex(key);
+
+    if (index != size() && !Compare{}(key, _keys.at(index)))
+        return std::make_pair(iteratorAt(index), false);
+    emplaceAt(index, std::forward<KeyArg>(key), std::forward<Args>(args)...);
+    return std::make_pair(iteratorAt(index), true);
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+template<typename KeyArg, typename ValueArg>
+inline std::pair<typename Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::Iterator, bool>
+    Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::insertOrAssign(KeyArg &&key, ValueArg &&value)
+{
+    const auto index = lowerBoundIndex(key);
+
+    if (index != size() && !Compare{}(key, _keys.at(index))) {
+        _values.at(index) = std::forward<ValueArg>(value);
+        return std::make_pair(iteratorAt(index), false);
+    }
+    emplaceAt(index, std::forward<KeyArg>(key), std::forward<ValueArg>(value));
+    return std::make_pair(iteratorAt(index), true);
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+template<typename KeyArg, typename ...Args>
+inline void Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::emplaceAt(
+        const Range index, KeyArg &&key, Args &&...args)
+{
+    // Both vectors are only modified once the value and the key are constructed
+    Value newValue(std::forward<Args>(args)...);
+    Key newKey(std::forward<KeyArg>(key));
+
+    _values.emplace(_values.begin() + index, std::move(newValue));
+    _keys.emplace(_keys.begin() + index, std::move(newKey));
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+template<typename Lookup>
+inline Value &Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::at(const Lookup &key) noexcept_ndebug
+{
+    const auto index = findIndex(key);
+
+    coreAssert(index != size(),
+        throw std::out_of_range("Core::SortedFlatMap::at: Key not found"));
+    return _values.at(index);
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+template<typename Lookup>
+inline const Value &Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::at(const Lookup &key) const noexcept_ndebug
+{
+    const auto index = findIndex(key);
+
+    coreAssert(index != size(),
+        throw std::out_of_range("Core::SortedFlatMap::at: Key not found"));
+    return _values.at(index);
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+template<typename Lookup>
+inline std::enable_if_t<!std::is_convertible_v<const Lookup &, typename Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::ConstIterator>, bool>
+    Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::erase(const Lookup &key)
+        noexcept(nothrow_destructible(Key) && nothrow_destructible(Value))
+{
+    const auto index = findIndex(key);
+
+    if (index == size())
+        return false;
+    _keys.erase(_keys.begin() + index);
+    _values.erase(_values.begin() + index);
+    return true;
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+inline typename Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::Iterator
+    Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::erase(const ConstIterator pos)
+        noexcept(nothrow_destructible(Key) && nothrow_destructible(Value))
+{
+    const auto index = static_cast<Range>(pos._key - _keys.data());
+
+    _keys.erase(_keys.begin() + index);
+    _values.erase(_values.begin() + index);
+    return iteratorAt(index);
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+template<typename Lookup>
+inline Range Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::lowerBoundIndex(const Lookup &key) const
+    noexcept_invocable(Compare, const Key &, const Lookup &)
+{
+    const auto first = _keys.data();
+
+    return static_cast<Range>(Utils::BranchlessSearch(first, size(), [&key](const Key &other) { return Compare{}(other, key); }) - first);
+}
+
+template<typename Key, typename Value, typename Range, typename Compare, typename KeyVector, typename ValueVector>
+template<typename Lookup>
+inline Range Core::Internal::SortedFlatMapDetails<Key, Value, Range, Compare, KeyVector, ValueVector>::findIndex(const Lookup &key) const
+    noexcept(nothrow_invocable(Compare, const Key &, const Lookup &) && nothrow_invocable(Compare, const Lookup &, const Key &))
+{
+    const auto count = size();
+    const auto index = lowerBoundIndex(key);
+
+    return index != count && !Compare{}(key, _keys.at(index)) ? index : count;
+}
@@ -0,0 +1,27 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Sorted flat map over FlatVectors
+ */
+
+#pragma once
+
+#include "SortedFlatMapDetails.hpp"
+#include "FlatVector.hpp"
+
+namespace Core
+{
+    /**
+     * @brief 16 bytes sorted map storing its keys and values in two parallel FlatVectors
+     *
+     * @tparam Key Key type
+     * @tparam Value Mapped type
+     * @tparam Range Range of container
+     * @tparam Compare Compare operator of the keys
+     */
+    template<typename Key, typename Value, typename Range = std::size_t, typename Compare = KeyLess>
+    using SortedFlatVectorMap = Internal::SortedFlatMapDetails<Key, Value, Range, Compare, FlatVector<Key, Range>, FlatVector<Value, Range>>;
+
+    /** @brief 16 bytes sorted flat map with a reduced range */
+    template<typename Key, typename Value, typename Compare = KeyLess>
+    using SortedTinyFlatVectorMap = SortedFlatVectorMap<Key, Value, std::uint32_t, Compare>;
+}
@@ -0,0 +1,30 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Sorted flat map over SmallVectors
+ */
+
+#pragma once
+
+#include "SortedFlatMapDetails.hpp"
+#include "SmallVector.hpp"
+
+namespace Core
+{
+    /**
+     * @brief Sorted map storing its keys and values in two parallel SmallVectors
+     * The first 'OptimizedCapacity' elements don't allocate
+     *
+     * @tparam Key Key type
+     * @tparam Value Mapped type
+     * @tparam OptimizedCapacity Count of element in the optimized caches
+     * @tparam Range Range of container
+     * @tparam Compare Compare operator of the keys
+     */
+    template<typename Key, typename Value, std::size_t OptimizedCapacity, typename Range = std::size_t, typename Compare = KeyLess>
+    using SortedSmallFlatMap = Internal::SortedFlatMapDetails<Key, Value, Range, Compare,
+            SmallVector<Key, OptimizedCapacity, Range>, SmallVector<Value, OptimizedCapacity, Range>>;
+
+    /** @brief Small optimized sorted flat map with a reduced range */
+    template<typename Key, typename Value, std::size_t OptimizedCapacity, typename Compare = KeyLess>
+    using SortedTinySmallFlatMap = SortedSmallFlatMap<Key, Value, OptimizedCapacity, std::uint32_t, Compare>;
+}
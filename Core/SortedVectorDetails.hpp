@@ -144,19 +144,94 @@ public:
     Range assign(const Range index, AssignType &&value);
 
 
-    /** @brief Finds where to insert an element */
+    /** @brief Finds where to insert an element, after its equivalents */
     [[nodiscard]] Iterator findSortedPlacement(const Type &value)
         noexcept_invocable(Compare, const Type &, const Type &)
-        { return DetailsBase::find([&value](const Type &other) { return Compare{}(value, other); }); }
+        { return upperBound(value); }
     [[nodiscard]] ConstIterator findSortedPlacement(const Type &value) const
         noexcept_invocable(Compare, const Type &, const Type &)
-        { return DetailsBase::find([&value](const Type &other) { return Compare{}(value, other); }); }
+        { return upperBound(value); }
+
+
+    /** @brief Find the first element not ordered before 'value' */
+    template<typename Comparable>
+    [[nodiscard]] Iterator lowerBound(const Comparable &value) noexcept_invocable(Compare, const Type &, const Comparable &)
+        { return Utils::BranchlessSearch(DetailsBase::begin(), DetailsBase::size(), [&value](const Type &other) { return Compare{}(other, value); }); }
+    template<typename Comparable>
+    [[nodiscard]] ConstIterator lowerBound(const Comparable &value) const noexcept_invocable(Compare, const Type &, const Comparable &)
+        { return Utils::BranchlessSearch(DetailsBase::begin(), DetailsBase::size(), [&value](const Type &other) { return Compare{}(other, value); }); }
+
+    /** @brief Find the first element ordered after 'value' */
+    template<typename Comparable>
+    [[nodiscard]] Iterator upperBound(const Comparable &value) noexcept_invocable(Compare, const Comparable &, const Type &)
+        { return Utils::BranchlessSearch(DetailsBase::begin(), DetailsBase::size(), [&value](const Type &other) { return !Compare{}(value, other); }); }
+    template<typename Comparable>
+    [[nodiscard]] ConstIterator upperBound(const Comparable &value) const noexcept_invocable(Compare, const Comparable &, const Type &)
+        { return Utils::BranchlessSearch(DetailsBase::begin(), DetailsBase::size(), [&value](const Type &other) { return !Compare{}(value, other); }); }
+
+    /** @brief Find the first element equivalent to 'value' by binary search
+     *  @return end() if not found */
+    template<typename Comparable>
+    [[nodiscard]] std::enable_if_t<!std::is_invocable_v<const Comparable &, const Type &>, Iterator> find(const Comparable &value)
+        noexcept(nothrow_invocable(Compare, const Type &, const Comparable &) && nothrow_invocable(Compare, const Comparable &, const Type &))
+        { const auto it = lowerBound(value); return it != DetailsBase::end() && !Compare{}(value, *it) ? it : DetailsBase::end(); }
+    template<typename Comparable>
+    [[nodiscard]] std::enable_if_t<!std::is_invocable_v<const Comparable &, const Type &>, ConstIterator> find(const Comparable &value) const
+        noexcept(nothrow_invocable(Compare, const Type &, const Comparable &) && nothrow_invocable(Compare, const Comparable &, const Type &))
+        { const auto it = lowerBound(value); return it != DetailsBase::end() && !Compare{}(value, *it) ? it : DetailsBase::end(); }
+
+    /** @brief Find an element with functor */
+    using DetailsBase::find;
+
+    /** @brief Check if the vector contains an element equivalent to 'value' */
+    template<typename Comparable>
+    [[nodiscard]] bool contains(const Comparable &value) const
+        noexcept(nothrow_invocable(Compare, const Type &, const Comparable &) && nothrow_invocable(Compare, const Comparable &, const Type &))
+        { return find(value) != DetailsBase::end(); }
 
 private:
+    /** @brief Detect transparent comparators */
+    template<typename Comparator>
+    using IsTransparentDetector = typename Comparator::is_transparent;
+
+    /** @brief Check if a single push argument can be compared with the elements without constructing a Type */
+    template<typename ...Args>
+    struct IsKeyComparable
+    {
+        static constexpr bool Value = false;
+    };
+
+    template<typename Arg>
+    struct IsKeyComparable<Arg>
+    {
+        static constexpr bool Value = std::is_same_v<std::remove_cvref_t<Arg>, Type>
+            || (Utils::IsDetected<IsTransparentDetector, Compare>
+                && std::is_invocable_r_v<bool, Compare, const std::remove_cvref_t<Arg> &, const Type &>);
+    };
+
+    /** @brief Check if an address lies inside the stored elements */
+    [[nodiscard]] bool isStored(const void * const address) const noexcept
+    {
+        const auto value = reinterpret_cast<std::uintptr_t>(address);
+        return value >= reinterpret_cast<std::uintptr_t>(DetailsBase::begin())
+            && value < reinterpret_cast<std::uintptr_t>(DetailsBase::end());
+    }
+
+    /** @brief Sort the elements inserted after the first 'sortedCount' ones and merge them with the sorted ones
+     *  Costs O(n + m log m) instead of sorting the whole vector, the merge buffer comes from the allocator of the vector */
+    void mergeInserted(const Range sortedCount);
+
     /** @brief Reimplemented functions */
     using DetailsBase::push;
     using DetailsBase::insert;
     using DetailsBase::resize;
 };
 
+/** @brief Sorted vectors are relocatable as their underlying vector */
+template<typename Base, typename Type, typename Range, typename Compare, bool IsSmallOptimized>
+struct Core::IsTriviallyRelocatable<Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>>
+{
+    static constexpr bool Value = !IsSmallOptimized;
+};
+
 #include "SortedVectorDetails.ipp"
\ No newline at end of file
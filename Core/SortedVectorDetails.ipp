@@ -9,9 +9,13 @@ inline std::enable_if_t<std::is_constructible_v<Type, Args...>, Type &> Core::In
 {
     if (!DetailsBase::data())
         return DetailsBase::push(std::forward<Args>(args)...);
+    if constexpr (IsKeyComparable<Args...>::Value) {
+        // The key is directly comparable: construct in the gap unless the gap opening would move it
+        if (!isStored(std::addressof(args)...))
+            return *DetailsBase::emplace(upperBound(args...), std::forward<Args>(args)...);
+    }
     Type value(std::forward<Args>(args)...);
-    auto it = findSortedPlacement(value);
-    return *DetailsBase::insert(it, std::move(value)); // @todo use a real emplace constructor to push
+    return *DetailsBase::emplace(findSortedPlacement(value), std::move(value));
 }
 
 template<typename Base, typename Type, typename Range, typename Compare, bool IsSmallOptimized>
@@ -36,8 +40,9 @@ inline void Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSm
         InputIterator from, InputIterator to)
 {
     if (from != to) {
+        const auto count = DetailsBase::size();
         DetailsBase::insert(DetailsBase::end(), from, to);
-        sort();
+        mergeInserted(count);
     }
 }
 
@@ -47,8 +52,9 @@ inline void Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSm
         InputIterator from, InputIterator to, Map &&map)
 {
     if (from != to) {
+        const auto count = DetailsBase::size();
         DetailsBase::insert(DetailsBase::end(), from, to, std::forward<Map>(map));
-        sort();
+        mergeInserted(count);
     }
 }
 
@@ -82,32 +88,74 @@ inline void Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSm
 }
 
 template<typename Base, typename Type, typename Range, typename Compare, bool IsSmallOptimized>
-template<typename AssignType>
-Range Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::assign(const Range index, AssignType &&value)
+inline void Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::mergeInserted(const Range sortedCount)
 {
-    const auto count = DetailsBase::sizeUnsafe();
-    auto &elem = DetailsBase::at(index);
-    Range finalPos = index;
+    const auto first = DetailsBase::beginUnsafe();
+    const auto middle = first + sortedCount;
+    const auto last = DetailsBase::endUnsafe();
+
+    std::sort(middle, last, Compare{});
+    // Already ordered batches (ex: appended events) don't need to merge
+    if (!sortedCount || !Compare{}(*middle, *(middle - 1)))
+        return;
+    // Elements ordered before the batch are already in place
+    const auto &front = *middle;
+    const auto from = Utils::BranchlessSearch(first, sortedCount, [&front](const Type &other) { return !Compare{}(front, other); });
+    // The smallest run is moved to a scratch buffer taken from the allocator of the vector
+    const auto leftCount = static_cast<Range>(middle - from);
+    const auto rightCount = static_cast<Range>(last - middle);
+    const auto scratchCount = std::min(leftCount, rightCount);
+    const auto scratch = Base::allocateScratch(scratchCount);
 
-    elem = std::forward<AssignType>(value);
-    if (index > 0 && !Compare{}(DetailsBase::at(index - 1), elem)) {
-        finalPos = index - 1;
-        for (auto i = index - 2; i > 0; --i) {
-            if (!Compare{}(DetailsBase::at(i), elem))
-                finalPos = i;
+    if (leftCount <= rightCount) {
+        // Merge forward, equivalent elements of the left run stay first
+        std::uninitialized_move(from, middle, scratch);
+        auto left = scratch;
+        auto right = middle;
+        for (auto out = from; left != scratch + scratchCount; ++out) {
+            if (right != last && Compare{}(*right, *left))
+                *out = std::move(*right++);
             else
-                break;
+                *out = std::move(*left++);
         }
-        std::swap(DetailsBase::at(finalPos), elem);
-    } else if (index + 1 < count && !Compare{}(elem, DetailsBase::at(index + 1))) {
-        finalPos = index + 1;
-        for (auto i = index + 2; i < count; ++i) {
-            if (!Compare{}(elem, DetailsBase::at(i))) {
-                finalPos = i;
-            } else
-                break;
+    } else {
+        // Merge backward, equivalent elements of the right run stay last
+        std::uninitialized_move(middle, last, scratch);
+        auto left = middle;
+        auto right = scratch + scratchCount;
+        for (auto out = last; right != scratch; ) {
+            if (left != from && Compare{}(*(right - 1), *(left - 1)))
+                *--out = std::move(*--left);
+            else
+                *--out = std::move(*--right);
         }
-        std::swap(DetailsBase::at(finalPos), elem);
     }
-    return finalPos;
+    std::destroy_n(scratch, scratchCount);
+    Base::deallocateScratch(scratch, scratchCount);
+}
+
+template<typename Base, typename Type, typename Range, typename Compare, bool IsSmallOptimized>
+template<typename AssignType>
+Range Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::assign(const Range index, AssignType &&value)
+{
+    const auto first = DetailsBase::beginUnsafe();
+    const auto last = DetailsBase::endUnsafe();
+    const auto elem = first + index;
+
+    *elem = std::forward<AssignType>(value);
+    const auto &current = *elem;
+    // Like a push, a moved element is placed after its equivalents
+    const auto isBefore = [&current](const Type &other) { return !Compare{}(current, other); };
+    if (index > 0 && Compare{}(current, *(elem - 1))) {
+        // Move left, shifting the skipped elements by one
+        const auto to = Utils::BranchlessSearch(first, index, isBefore);
+        std::rotate(to, elem, elem + 1);
+        return static_cast<Range>(to - first);
+    } else if (elem + 1 < last && Compare{}(*(elem + 1), current)) {
+        // Move right, shifting the skipped elements by one
+        const auto to = Utils::BranchlessSearch(elem + 1, static_cast<Range>(last - elem - 1), isBefore);
+        std::rotate(elem, elem + 1, to);
+        return static_cast<Range>(to - first - 1);
+    }
+    return index;
 }
\ No newline at end of file
@@ -0,0 +1,453 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Vectorized string algorithms
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "StringAlgorithms.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+# include <immintrin.h>
+# define CORE_STRING_SSE2
+# if defined(__GNUC__)
+#  define CORE_STRING_AVX2
+# endif
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+using namespace Core;
+
+namespace
+{
+    using Kernels = Utils::StringKernels;
+
+    [[nodiscard]] constexpr char ToLower(const char value) noexcept
+        { return value >= 'A' && value <= 'Z' ? static_cast<char>(value + ('a' - 'A')) : value; }
+
+    [[nodiscard]] inline unsigned CountTrailingZeros(const unsigned mask) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+    }
+
+
+    template<typename Word>
+    [[nodiscard]] inline Word LoadWord(const char * const data) noexcept
+    {
+        Word word;
+        std::memcpy(&word, data, sizeof(Word));
+        return word;
+    }
+
+    /** @brief Inline comparison by words, the last word overlaps the previous ones
+     *  Avoids a library call (and vector registers spills) for the short sizes of names */
+    [[nodiscard]] inline bool EqualBytes(const char *lhs, const char *rhs, const std::size_t size) noexcept
+    {
+        if (size >= sizeof(std::uint64_t)) {
+            for (auto i = 0ul; i + sizeof(std::uint64_t) < size; i += sizeof(std::uint64_t)) {
+                if (LoadWord<std::uint64_t>(lhs + i) != LoadWord<std::uint64_t>(rhs + i))
+                    return false;
+            }
+            const auto last = size - sizeof(std::uint64_t);
+            return LoadWord<std::uint64_t>(lhs + last) == LoadWord<std::uint64_t>(rhs + last);
+        } else if (size >= sizeof(std::uint32_t)) {
+            const auto last = size - sizeof(std::uint32_t);
+            return LoadWord<std::uint32_t>(lhs) == LoadWord<std::uint32_t>(rhs)
+                && LoadWord<std::uint32_t>(lhs + last) == LoadWord<std::uint32_t>(rhs + last);
+        }
+        for (auto i = 0ul; i < size; ++i) {
+            if (lhs[i] != rhs[i])
+                return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool EqualScalar(const char *lhs, const char *rhs, std::size_t size) noexcept
+    {
+        return EqualBytes(lhs, rhs, size);
+    }
+
+    [[nodiscard]] bool EqualCaseInsensitiveScalar(const char *lhs, const char *rhs, std::size_t size) noexcept
+    {
+        for (auto i = 0ul; i < size; ++i) {
+            if (ToLower(lhs[i]) != ToLower(rhs[i]))
+                return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] const char *FindCharScalar(const char *data, std::size_t size, char value) noexcept
+    {
+        return size ? reinterpret_cast<const char *>(std::memchr(data, value, size)) : nullptr;
+    }
+
+    [[nodiscard]] const char *FindStringScalar(const char *data, std::size_t size, const char *needle, std::size_t needleSize) noexcept
+    {
+        const auto index = std::string_view(data, size).find(std::string_view(needle, needleSize));
+        return index == std::string_view::npos ? nullptr : data + index;
+    }
+
+    constexpr Kernels ScalarKernels {
+        "Scalar", &EqualScalar, &EqualCaseInsensitiveScalar, &FindCharScalar, &FindStringScalar
+    };
+
+
+#if defined(CORE_STRING_SSE2)
+    constexpr std::size_t SSE2Width = 16ul;
+
+    [[nodiscard]] inline __m128i LoadSSE2(const char * const data) noexcept
+        { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)); }
+
+    [[nodiscard]] inline unsigned MatchSSE2(const __m128i lhs, const __m128i rhs) noexcept
+        { return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs))); }
+
+    /** @brief ASCII lower case of 16 characters, 'A' to 'Z' are the only bytes in [0, 25] once 'A' is subtracted */
+    [[nodiscard]] inline __m128i ToLowerSSE2(const __m128i value) noexcept
+    {
+        const auto offset = _mm_sub_epi8(value, _mm_set1_epi8('A'));
+        const auto isUpper = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(25)), offset);
+        return _mm_or_si128(value, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+    }
+
+    /** @brief Compare a block of 16 characters */
+    template<bool CaseInsensitive>
+    [[nodiscard]] inline bool EqualBlockSSE2(const char * const lhs, const char * const rhs) noexcept
+    {
+        auto left = LoadSSE2(lhs);
+        auto right = LoadSSE2(rhs);
+
+        if constexpr (CaseInsensitive) {
+            left = ToLowerSSE2(left);
+            right = ToLowerSSE2(right);
+        }
+        return MatchSSE2(left, right) == 0xFFFFu;
+    }
+
+    /** @brief Compare blocks of 16 characters, the last block overlaps the previous one */
+    template<bool CaseInsensitive>
+    [[nodiscard]] bool EqualSSE2(const char *lhs, const char *rhs, std::size_t size) noexcept
+    {
+        if (size < SSE2Width) {
+            if constexpr (CaseInsensitive)
+                return EqualCaseInsensitiveScalar(lhs, rhs, size);
+            else
+                return EqualScalar(lhs, rhs, size);
+        }
+        for (auto i = 0ul; i + SSE2Width <= size; i += SSE2Width) {
+            if (!EqualBlockSSE2<CaseInsensitive>(lhs + i, rhs + i))
+                return false;
+        }
+        return !(size % SSE2Width) || EqualBlockSSE2<CaseInsensitive>(lhs + size - SSE2Width, rhs + size - SSE2Width);
+    }
+
+    [[nodiscard]] const char *FindCharSSE2(const char *data, std::size_t size, char value) noexcept
+    {
+        const auto target = _mm_set1_epi8(value);
+        auto i = 0ul;
+
+        if (size < SSE2Width) {
+            for (; i < size; ++i) {
+                if (data[i] == value)
+                    return data + i;
+            }
+            return nullptr;
+        }
+        for (; i + SSE2Width <= size; i += SSE2Width) {
+            if (const auto mask = MatchSSE2(LoadSSE2(data + i), target); mask)
+                return data + i + CountTrailingZeros(mask);
+        }
+        if (i != size) {
+            // Last block overlaps the previous one, already checked positions are masked
+            const auto last = size - SSE2Width;
+            if (const auto mask = MatchSSE2(LoadSSE2(data + last), target) >> (i - last); mask)
+                return data + i + CountTrailingZeros(mask);
+        }
+        return nullptr;
+    }
+
+    /** @brief Filter 16 candidate positions at once by matching the first and the last character of the needle */
+    [[nodiscard]] const char *FindStringSSE2(const char *data, std::size_t size, const char *needle, std::size_t needleSize) noexcept
+    {
+        if (needleSize <= 1)
+            return needleSize ? FindCharSSE2(data, size, *needle) : data;
+        else if (needleSize > size)
+            return nullptr;
+        // Number of candidate positions
+        const auto count = size - needleSize + 1;
+
+        if (count < SSE2Width) {
+            for (auto i = 0ul; i < count; ++i) {
+                if (data[i] == needle[0] && EqualBytes(data + i + 1, needle + 1, needleSize - 1))
+                    return data + i;
+            }
+            return nullptr;
+        }
+        const auto first = _mm_set1_epi8(needle[0]);
+        const auto last = _mm_set1_epi8(needle[needleSize - 1]);
+        const auto search = [data, needle, needleSize, first, last](const std::size_t index, unsigned skip) -> const char * {
+            auto mask = (MatchSSE2(LoadSSE2(data + index), first) & MatchSSE2(LoadSSE2(data + index + needleSize - 1), last)) >> skip << skip;
+            while (mask) {
+                const auto candidate = data + index + CountTrailingZeros(mask);
+                if (EqualBytes(candidate + 1, needle + 1, needleSize - 2))
+                    return candidate;
+                mask &= mask - 1;
+            }
+            return nullptr;
+        };
+        auto i = 0ul;
+
+        for (; i + SSE2Width <= count; i += SSE2Width) {
+            if (const auto found = search(i, 0u); found)
+                return found;
+        }
+        // Last block overlaps the previous one, already checked positions are skipped
+        if (i != count)
+            return search(count - SSE2Width, static_cast<unsigned>(i - (count - SSE2Width)));
+        return nullptr;
+    }
+
+    constexpr Kernels SSE2Kernels {
+        "SSE2", &EqualSSE2<false>, &EqualSSE2<true>, &FindCharSSE2, &FindStringSSE2
+    };
+#endif
+
+
+#if defined(CORE_STRING_AVX2)
+# define CORE_TARGET_AVX2 __attribute__((target("avx2")))
+
+    constexpr std::size_t AVX2Width = 32ul;
+
+    [[nodiscard]] CORE_TARGET_AVX2 inline __m256i LoadAVX2(const char * const data) noexcept
+        { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data)); }
+
+    [[nodiscard]] CORE_TARGET_AVX2 inline unsigned MatchAVX2(const __m256i lhs, const __m256i rhs) noexcept
+        { return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs))); }
+
+    [[nodiscard]] CORE_TARGET_AVX2 inline __m256i ToLowerAVX2(const __m256i value) noexcept
+    {
+        const auto offset = _mm256_sub_epi8(value, _mm256_set1_epi8('A'));
+        const auto isUpper = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(25)), offset);
+        return _mm256_or_si256(value, _mm256_and_si256(isUpper, _mm256_set1_epi8(0x20)));
+    }
+
+    /** @brief Equal bytes of a block of 32 characters */
+    template<bool CaseInsensitive>
+    [[nodiscard]] CORE_TARGET_AVX2 inline __m256i EqualBlockAVX2(const char * const lhs, const char * const rhs) noexcept
+    {
+        auto left = LoadAVX2(lhs);
+        auto right = LoadAVX2(rhs);
+
+        if constexpr (CaseInsensitive) {
+            left = ToLowerAVX2(left);
+            right = ToLowerAVX2(right);
+        }
+        return _mm256_cmpeq_epi8(left, right);
+    }
+
+    [[nodiscard]] CORE_TARGET_AVX2 inline bool AllSetAVX2(const __m256i value) noexcept
+        { return static_cast<unsigned>(_mm256_movemask_epi8(value)) == 0xFFFFFFFFu; }
+
+    /** @brief Compare two blocks of 32 characters per iteration, the last block overlaps the previous one */
+    template<bool CaseInsensitive>
+    [[nodiscard]] CORE_TARGET_AVX2 bool EqualAVX2(const char *lhs, const char *rhs, std::size_t size) noexcept
+    {
+        if (size < AVX2Width)
+            return EqualSSE2<CaseInsensitive>(lhs, rhs, size);
+        auto i = 0ul;
+
+        for (; i + 2 * AVX2Width <= size; i += 2 * AVX2Width) {
+            const auto equal = _mm256_and_si256(EqualBlockAVX2<CaseInsensitive>(lhs + i, rhs + i),
+                    EqualBlockAVX2<CaseInsensitive>(lhs + i + AVX2Width, rhs + i + AVX2Width));
+            if (!AllSetAVX2(equal))
+                return false;
+        }
+        if (i + AVX2Width <= size) {
+            if (!AllSetAVX2(EqualBlockAVX2<CaseInsensitive>(lhs + i, rhs + i)))
+                return false;
+            i += AVX2Width;
+        }
+        return i == size || AllSetAVX2(EqualBlockAVX2<CaseInsensitive>(lhs + size - AVX2Width, rhs + size - AVX2Width));
+    }
+
+    /** @brief Search four blocks of 32 characters per iteration, the last block overlaps the previous one */
+    [[nodiscard]] CORE_TARGET_AVX2 const char *FindCharAVX2(const char *data, std::size_t size, char value) noexcept
+    {
+        if (size < AVX2Width)
+            return FindCharSSE2(data, size, value);
+        const auto target = _mm256_set1_epi8(value);
+        auto i = 0ul;
+
+        for (; i + 4 * AVX2Width <= size; i += 4 * AVX2Width) {
+            const __m256i blocks[4] {
+                _mm256_cmpeq_epi8(LoadAVX2(data + i), target),
+                _mm256_cmpeq_epi8(LoadAVX2(data + i + AVX2Width), target),
+                _mm256_cmpeq_epi8(LoadAVX2(data + i + 2 * AVX2Width), target),
+                _mm256_cmpeq_epi8(LoadAVX2(data + i + 3 * AVX2Width), target)
+            };
+            if (!_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(blocks[0], blocks[1]), _mm256_or_si256(blocks[2], blocks[3]))))
+                continue;
+            for (auto block = 0ul; block < 4ul; ++block) {
+                if (const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(blocks[block])); mask)
+                    return data + i + block * AVX2Width + CountTrailingZeros(mask);
+            }
+        }
+        for (; i + AVX2Width <= size; i += AVX2Width) {
+            if (const auto mask = MatchAVX2(LoadAVX2(data + i), target); mask)
+                return data + i + CountTrailingZeros(mask);
+        }
+        if (i != size) {
+            const auto last = size - AVX2Width;
+            if (const auto mask = MatchAVX2(LoadAVX2(data + last), target) >> (i - last); mask)
+                return data + i + CountTrailingZeros(mask);
+        }
+        return nullptr;
+    }
+
+    /** @brief Candidate positions of a block of 32 characters, matching the first and the last character of the needle */
+    [[nodiscard]] CORE_TARGET_AVX2 inline __m256i CandidatesAVX2(const char * const data, const std::size_t needleSize,
+            const __m256i first, const __m256i last) noexcept
+    {
+        return _mm256_and_si256(_mm256_cmpeq_epi8(LoadAVX2(data), first), _mm256_cmpeq_epi8(LoadAVX2(data + needleSize - 1), last));
+    }
+
+    /** @brief Check the candidate positions of a block */
+    [[nodiscard]] inline const char *VerifyCandidates(const char * const data, unsigned mask,
+            const char * const needle, const std::size_t needleSize) noexcept
+    {
+        while (mask) {
+            const auto candidate = data + CountTrailingZeros(mask);
+            if (EqualBytes(candidate + 1, needle + 1, needleSize - 2))
+                return candidate;
+            mask &= mask - 1;
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] CORE_TARGET_AVX2 const char *FindStringAVX2(const char *data, std::size_t size, const char *needle, std::size_t needleSize) noexcept
+    {
+        if (needleSize <= 1)
+            return needleSize ? FindCharAVX2(data, size, *needle) : data;
+        else if (needleSize > size || size - needleSize + 1 < AVX2Width)
+            return FindStringSSE2(data, size, needle, needleSize);
+        const auto count = size - needleSize + 1;
+        const auto first = _mm256_set1_epi8(needle[0]);
+        const auto last = _mm256_set1_epi8(needle[needleSize - 1]);
+        auto i = 0ul;
+
+        for (; i + 4 * AVX2Width <= count; i += 4 * AVX2Width) {
+            const unsigned masks[4] {
+                static_cast<unsigned>(_mm256_movemask_epi8(CandidatesAVX2(data + i, needleSize, first, last))),
+                static_cast<unsigned>(_mm256_movemask_epi8(CandidatesAVX2(data + i + AVX2Width, needleSize, first, last))),
+                static_cast<unsigned>(_mm256_movemask_epi8(CandidatesAVX2(data + i + 2 * AVX2Width, needleSize, first, last))),
+                static_cast<unsigned>(_mm256_movemask_epi8(CandidatesAVX2(data + i + 3 * AVX2Width, needleSize, first, last)))
+            };
+            if (!(masks[0] | masks[1] | masks[2] | masks[3]))
+                continue;
+            for (auto block = 0ul; block < 4ul; ++block) {
+                if (const auto found = VerifyCandidates(data + i + block * AVX2Width, masks[block], needle, needleSize); found)
+                    return found;
+            }
+        }
+        for (; i + AVX2Width <= count; i += AVX2Width) {
+            const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(CandidatesAVX2(data + i, needleSize, first, last)));
+            if (const auto found = VerifyCandidates(data + i, mask, needle, needleSize); found)
+                return found;
+        }
+        if (i != count) {
+            // Last block overlaps the previous one, already checked positions are skipped
+            const auto index = count - AVX2Width;
+            const auto skip = static_cast<unsigned>(i - index);
+            const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(CandidatesAVX2(data + index, needleSize, first, last))) >> skip << skip;
+            return VerifyCandidates(data + index, mask, needle, needleSize);
+        }
+        return nullptr;
+    }
+
+    constexpr Kernels AVX2Kernels {
+        "AVX2", &EqualAVX2<false>, &EqualAVX2<true>, &FindCharAVX2, &FindStringAVX2
+    };
+
+# undef CORE_TARGET_AVX2
+#endif
+
+
+#if defined(CORE_STRING_SSE2)
+    constexpr const Kernels &BaselineKernels = SSE2Kernels;
+#else
+    constexpr const Kernels &BaselineKernels = ScalarKernels;
+#endif
+
+    /** @brief Short strings (most names) use the baseline kernels directly, the dispatch doesn't pay off for them */
+    constexpr std::size_t DispatchThreshold = 64ul;
+
+    /** @brief Every kernel set compiled in, ordered by instruction set */
+    constexpr Kernels AllKernels[] {
+        ScalarKernels,
+#if defined(CORE_STRING_SSE2)
+        SSE2Kernels,
+#endif
+#if defined(CORE_STRING_AVX2)
+        AVX2Kernels,
+#endif
+    };
+
+    /** @brief Select the best kernels supported by the running CPU */
+    [[nodiscard]] inline const Kernels &GetKernels(void) noexcept
+    {
+        return Utils::SupportedStringKernels().back();
+    }
+}
+
+std::span<const Utils::StringKernels> Utils::SupportedStringKernels(void) noexcept
+{
+    // Kernels are ordered by instruction set, the unsupported ones are at the end, once
+    static const std::size_t count = [](void) -> std::size_t {
+#if defined(CORE_STRING_AVX2)
+        if (!__builtin_cpu_supports("avx2"))
+            return std::size(AllKernels) - 1;
+#endif
+        return std::size(AllKernels);
+    }();
+
+    return std::span<const StringKernels>(AllKernels, count);
+}
+
+bool Utils::StringEqual(const char * const lhs, const char * const rhs, const std::size_t size) noexcept
+{
+    if (size < DispatchThreshold)
+        return BaselineKernels.equal(lhs, rhs, size);
+    return GetKernels().equal(lhs, rhs, size);
+}
+
+bool Utils::StringEqualCaseInsensitive(const char * const lhs, const char * const rhs, const std::size_t size) noexcept
+{
+    if (size < DispatchThreshold)
+        return BaselineKernels.equalCaseInsensitive(lhs, rhs, size);
+    return GetKernels().equalCaseInsensitive(lhs, rhs, size);
+}
+
+const char *Utils::StringFind(const char * const data, const std::size_t size, const char value) noexcept
+{
+    if (size < DispatchThreshold)
+        return BaselineKernels.findChar(data, size, value);
+    return GetKernels().findChar(data, size, value);
+}
+
+const char *Utils::StringFind(const char * const data, const std::size_t size,
+        const char * const needle, const std::size_t needleSize) noexcept
+{
+    if (size < DispatchThreshold)
+        return BaselineKernels.findString(data, size, needle, needleSize);
+    return GetKernels().findString(data, size, needle, needleSize);
+}
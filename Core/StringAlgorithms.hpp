@@ -0,0 +1,42 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Vectorized string algorithms
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace Core::Utils
+{
+    /** @brief Set of string kernels of an instruction set */
+    struct StringKernels
+    {
+        const char *name;
+        bool (*equal)(const char *, const char *, std::size_t) noexcept;
+        bool (*equalCaseInsensitive)(const char *, const char *, std::size_t) noexcept;
+        const char *(*findChar)(const char *, std::size_t, char) noexcept;
+        const char *(*findString)(const char *, std::size_t, const char *, std::size_t) noexcept;
+    };
+
+    /** @brief Get the kernels supported by the running CPU, from the scalar fallback to the best one
+     *  The functions below dispatch to the last one, the others are exposed to be tested */
+    [[nodiscard]] std::span<const StringKernels> SupportedStringKernels(void) noexcept;
+
+    /** @brief Compare two character buffers of the same size
+     *  The implementation (AVX2, SSE2 or scalar) is selected at runtime */
+    [[nodiscard]] bool StringEqual(const char * const lhs, const char * const rhs, const std::size_t size) noexcept;
+
+    /** @brief Compare two character buffers of the same size, ignoring ASCII case */
+    [[nodiscard]] bool StringEqualCaseInsensitive(const char * const lhs, const char * const rhs, const std::size_t size) noexcept;
+
+    /** @brief Find the first occurrence of a character
+     *  @return nullptr if not found */
+    [[nodiscard]] const char *StringFind(const char * const data, const std::size_t size, const char value) noexcept;
+
+    /** @brief Find the first occurrence of a substring, an empty substring matches the beginning of data
+     *  @return nullptr if not found */
+    [[nodiscard]] const char *StringFind(const char * const data, const std::size_t size,
+            const char * const needle, const std::size_t needleSize) noexcept;
+}
@@ -10,6 +10,7 @@
 #include <cstring>
 
 #include "Utils.hpp"
+#include "StringAlgorithms.hpp"
 
 namespace Core::Internal
 {
@@ -38,6 +39,12 @@ public:
     using Base::grow;
     using Base::operator bool;
 
+    /** @brief Output iterator */
+    using Iterator = typename Base::Iterator;
+
+    /** @brief Input iterator */
+    using ConstIterator = typename Base::ConstIterator;
+
     /** @brief Base::Default constructor */
     StringDetails(void) noexcept = default;
 
@@ -78,15 +85,43 @@ public:
     StringDetails &operator=(const std::basic_string_view<Type> &other) noexcept { resize(other.begin(), other.end()); return *this; }
 
     /** @brief Comparison operator */
-    [[nodiscard]] bool operator==(const StringDetails &other) const noexcept { return std::equal(begin(), end(), other.begin(), other.end()); }
+    [[nodiscard]] bool operator==(const StringDetails &other) const noexcept { return Equal(data(), size(), other.data(), other.size()); }
     [[nodiscard]] bool operator!=(const StringDetails &other) const noexcept { return !operator==(other); }
-    [[nodiscard]] bool operator==(const char * const cstring) const noexcept { return std::equal(begin(), end(), cstring, cstring + SafeStrlen(cstring)); }
+    [[nodiscard]] bool operator==(const char * const cstring) const noexcept { return Equal(data(), size(), cstring, SafeStrlen(cstring)); }
     [[nodiscard]] bool operator!=(const char * const cstring) const noexcept { return !operator==(cstring); }
-    [[nodiscard]] bool operator==(const std::basic_string<Type> &other) const noexcept { return std::equal(begin(), end(), other.begin(), other.end()); }
+    [[nodiscard]] bool operator==(const std::basic_string<Type> &other) const noexcept { return Equal(data(), size(), other.data(), other.size()); }
     [[nodiscard]] bool operator!=(const std::basic_string<Type> &other) const noexcept { return !operator==(other); }
-    [[nodiscard]] bool operator==(const std::basic_string_view<Type> &other) const noexcept { return std::equal(begin(), end(), other.begin(), other.end()); }
+    [[nodiscard]] bool operator==(const std::basic_string_view<Type> &other) const noexcept { return Equal(data(), size(), other.data(), other.size()); }
     [[nodiscard]] bool operator!=(const std::basic_string_view<Type> &other) const noexcept { return !operator==(other); }
 
+    /** @brief Comparison ignoring ASCII case */
+    [[nodiscard]] bool equalsCaseInsensitive(const std::basic_string_view<Type> &other) const noexcept;
+
+
+    /** @brief Find the first occurrence of a character, returns end() if not found */
+    [[nodiscard]] Iterator find(const Type value) noexcept
+        { return const_cast<Iterator>(const_cast<const StringDetails *>(this)->find(value)); }
+    [[nodiscard]] ConstIterator find(const Type value) const noexcept;
+
+    /** @brief Find the first occurrence of a substring, returns end() if not found */
+    [[nodiscard]] Iterator find(const std::basic_string_view<Type> &value) noexcept
+        { return const_cast<Iterator>(const_cast<const StringDetails *>(this)->find(value)); }
+    [[nodiscard]] ConstIterator find(const std::basic_string_view<Type> &value) const noexcept;
+
+    /** @brief Find the first character matching a functor, returns end() if not found */
+    template<typename Functor>
+    [[nodiscard]] std::enable_if_t<std::is_invocable_v<Functor, Type &>, Iterator> find(Functor &&functor) noexcept
+        { return Base::find(std::forward<Functor>(functor)); }
+    template<typename Functor>
+    [[nodiscard]] std::enable_if_t<std::is_invocable_v<Functor, const Type &>, ConstIterator> find(Functor &&functor) const noexcept
+        { return Base::find(std::forward<Functor>(functor)); }
+
+    /** @brief Check if the string starts / ends with another one */
+    [[nodiscard]] bool startsWith(const std::basic_string_view<Type> &value) const noexcept
+        { return size() >= value.size() && Equal(data(), value.size(), value.data(), value.size()); }
+    [[nodiscard]] bool endsWith(const std::basic_string_view<Type> &value) const noexcept
+        { return size() >= value.size() && Equal(data() + (size() - value.size()), value.size(), value.data(), value.size()); }
+
 
     /** @brief Append operator */
     StringDetails &operator+=(const StringDetails &other) noexcept { insert(end(), other.begin(), other.end()); return *this; }
@@ -115,6 +150,16 @@ public:
 private:
     /** @brief Strlen but with null cstring check */
     [[nodiscard]] static std::size_t SafeStrlen(const char * const cstring) noexcept;
+
+    /** @brief Compare two buffers, byte characters use the vectorized algorithms */
+    [[nodiscard]] static bool Equal(const Type * const lhs, const std::size_t lhsSize, const Type * const rhs, const std::size_t rhsSize) noexcept;
+};
+
+/** @brief Strings are relocatable as their underlying vector */
+template<typename Base, typename Type, typename Range>
+struct Core::IsTriviallyRelocatable<Core::Internal::StringDetails<Base, Type, Range>>
+{
+    static constexpr bool Value = IsTriviallyRelocatable<Base>::Value;
 };
 
 #include "StringDetails.ipp"
\ No newline at end of file
@@ -62,4 +62,54 @@ inline std::size_t Core::Internal::StringDetails<Base, Type, Range>::SafeStrlen(
         return 0;
     else
         return std::strlen(cstring);
-}
\ No newline at end of file
+}
+
+template<typename Base, typename Type, typename Range>
+inline bool Core::Internal::StringDetails<Base, Type, Range>::Equal(const Type * const lhs, const std::size_t lhsSize,
+        const Type * const rhs, const std::size_t rhsSize) noexcept
+{
+    if (lhsSize != rhsSize)
+        return false;
+    else if constexpr (sizeof(Type) == 1)
+        return Utils::StringEqual(reinterpret_cast<const char *>(lhs), reinterpret_cast<const char *>(rhs), lhsSize);
+    else
+        return std::equal(lhs, lhs + lhsSize, rhs);
+}
+
+template<typename Base, typename Type, typename Range>
+inline bool Core::Internal::StringDetails<Base, Type, Range>::equalsCaseInsensitive(const std::basic_string_view<Type> &other) const noexcept
+{
+    if (size() != other.size())
+        return false;
+    else if constexpr (sizeof(Type) == 1)
+        return Utils::StringEqualCaseInsensitive(reinterpret_cast<const char *>(data()), reinterpret_cast<const char *>(other.data()), other.size());
+    else {
+        const auto toLower = [](const Type value) { return value >= 'A' && value <= 'Z' ? static_cast<Type>(value + ('a' - 'A')) : value; };
+        return std::equal(begin(), end(), other.begin(), [toLower](const Type lhs, const Type rhs) { return toLower(lhs) == toLower(rhs); });
+    }
+}
+
+template<typename Base, typename Type, typename Range>
+inline typename Core::Internal::StringDetails<Base, Type, Range>::ConstIterator
+    Core::Internal::StringDetails<Base, Type, Range>::find(const Type value) const noexcept
+{
+    if constexpr (sizeof(Type) == 1) {
+        const auto it = Utils::StringFind(reinterpret_cast<const char *>(data()), size(), static_cast<char>(value));
+        return it ? reinterpret_cast<ConstIterator>(it) : end();
+    } else
+        return std::find(begin(), end(), value);
+}
+
+template<typename Base, typename Type, typename Range>
+inline typename Core::Internal::StringDetails<Base, Type, Range>::ConstIterator
+    Core::Internal::StringDetails<Base, Type, Range>::find(const std::basic_string_view<Type> &value) const noexcept
+{
+    if (value.empty())
+        return begin();
+    else if constexpr (sizeof(Type) == 1) {
+        const auto it = Utils::StringFind(reinterpret_cast<const char *>(data()), size(),
+                reinterpret_cast<const char *>(value.data()), value.size());
+        return it ? reinterpret_cast<ConstIterator>(it) : end();
+    } else
+        return std::search(begin(), end(), value.begin(), value.end());
+}
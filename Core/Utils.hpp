@@ -12,10 +12,19 @@
 #include <utility>
 #include <cstdlib>
 #include <algorithm>
+#include <cstring>
+#include <memory>
 
 /** @brief Helper for unused variables */
 #define UNUSED(x) static_cast<void>(x)
 
+/** @brief Disable the thread sanitizer in functions with intended data races (ex: sequence locks) */
+#if defined(__GNUC__) || defined(__clang__)
+# define CORE_NO_SANITIZE_THREAD __attribute__((no_sanitize("thread")))
+#else
+# define CORE_NO_SANITIZE_THREAD
+#endif
+
 /** @brief Helper used to pass template into macro */
 #define TEMPLATE_TYPE(Class, ...) decltype(std::declval<Class<__VA_ARGS__>>())
 
@@ -112,6 +121,21 @@ namespace Core
     constexpr std::size_t CacheLineQuarterSize = CacheLineSize / 4;
     constexpr std::size_t CacheLineEighthSize = CacheLineSize / 8;
 
+    /** @brief Tell if a type can be relocated with memcpy, relocation being a move construction followed by the destruction of the source
+     *  Trivially copyable types are relocatable, other types may opt in through a specialization */
+    template<typename Type>
+    struct IsTriviallyRelocatable
+    {
+        static constexpr bool Value = std::is_trivially_copyable_v<Type>;
+    };
+
+    /** @brief A pair is relocatable when both of its members are */
+    template<typename First, typename Second>
+    struct IsTriviallyRelocatable<std::pair<First, Second>>
+    {
+        static constexpr bool Value = IsTriviallyRelocatable<First>::Value && IsTriviallyRelocatable<Second>::Value;
+    };
+
     namespace Utils
     {
         /** @brief Similar to std::aligned_alloc, but ensure arguments, you must use AlignedFree to free the memory */
@@ -125,6 +149,10 @@ namespace Core
         /**  @brief Free a pointer allocated with AlignedAlloc */
         void AlignedFree(void *data) noexcept;
 
+        /** @brief Resize a buffer allocated with AlignedAlloc, letting the system extend it in place when possible
+         *  @return nullptr if the alignment can't be preserved or the allocation failed, 'data' is then left untouched */
+        [[nodiscard]] void *AlignedRealloc(void *data, const std::size_t bytes, const std::size_t alignment) noexcept;
+
         /** @brief Helper to know if a given type is a std::move_iterator */
         template<typename Type>
         struct IsMoveIterator;
@@ -196,6 +224,29 @@ namespace Core
         /** @brief Find the closest power of 2 of value */
         template<typename Unit>
         [[nodiscard]] constexpr Unit NextPowerOf2(Unit value);
+
+        /** @brief Hint the processor to load the cacheline of an address, never faults */
+        inline void Prefetch([[maybe_unused]] const void * const address) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+#endif
+        }
+
+        /** @brief Branchless binary search of the first element of a partitioned range not matching 'isBefore'
+         *  The range is halved with a conditional move, the two possible next probes are prefetched */
+        template<typename Pointer, typename Count, typename Predicate>
+        [[nodiscard]] Pointer BranchlessSearch(Pointer first, Count count, Predicate &&isBefore)
+            noexcept(std::is_nothrow_invocable_v<Predicate, decltype(*first)>);
+
+        /** @brief Relocate 'count' elements to an uninitialized buffer that doesn't overlap, the source elements are destroyed */
+        template<typename Type>
+        void RelocateN(Type * const from, const std::size_t count, Type * const to)
+            noexcept(IsTriviallyRelocatable<Type>::Value || (nothrow_move_constructible(Type) && nothrow_destructible(Type)));
+
+        /** @brief Relocate the trivially relocatable range [from, fromEnd[ to a buffer that may overlap the source */
+        template<typename Type>
+        void RelocateOverlapping(Type * const from, Type * const fromEnd, Type * const to) noexcept;
     }
 }
 
@@ -33,6 +33,53 @@ inline void Core::Utils::AlignedFree(void *data) noexcept
     std::free(data);
 }
 
+inline void *Core::Utils::AlignedRealloc(void *data, const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    // realloc only guarantees the fundamental alignment, large blocks are remapped instead of copied
+    if (alignment > alignof(std::max_align_t))
+        return nullptr;
+    return std::realloc(data, bytes);
+}
+
+template<typename Type>
+inline void Core::Utils::RelocateN(Type * const from, const std::size_t count, Type * const to)
+    noexcept(IsTriviallyRelocatable<Type>::Value || (nothrow_move_constructible(Type) && nothrow_destructible(Type)))
+{
+    if constexpr (IsTriviallyRelocatable<Type>::Value) {
+        if (count)
+            std::memcpy(static_cast<void *>(to), static_cast<const void *>(from), sizeof(Type) * count);
+    } else {
+        std::uninitialized_move_n(from, count, to);
+        std::destroy_n(from, count);
+    }
+}
+
+template<typename Type>
+inline void Core::Utils::RelocateOverlapping(Type * const from, Type * const fromEnd, Type * const to) noexcept
+{
+    static_assert(IsTriviallyRelocatable<Type>::Value, "Core::Utils::RelocateOverlapping: Type must be trivially relocatable");
+
+    if (from < fromEnd)
+        std::memmove(static_cast<void *>(to), static_cast<const void *>(from), sizeof(Type) * static_cast<std::size_t>(fromEnd - from));
+}
+
+template<typename Pointer, typename Count, typename Predicate>
+inline Pointer Core::Utils::BranchlessSearch(Pointer first, Count count, Predicate &&isBefore)
+    noexcept(std::is_nothrow_invocable_v<Predicate, decltype(*first)>)
+{
+    if (!count)
+        return first;
+    while (count > 1) {
+        const auto half = static_cast<Count>(count / 2);
+        const auto next = static_cast<Count>((count - half) / 2);
+        Prefetch(first + next);
+        Prefetch(first + half + next);
+        first = isBefore(first[half]) ? first + half : first;
+        count = static_cast<Count>(count - half);
+    }
+    return first + isBefore(*first);
+}
+
 template<typename Unit>
 inline constexpr Unit Core::Utils::NextPowerOf2(Unit value)
 {
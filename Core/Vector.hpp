@@ -16,11 +16,12 @@ namespace Core
      *
      * @tparam Type Internal type in container
      * @tparam Range Range of container
+     * @tparam GrowthPolicy Policy computing the capacity when the vector runs out of memory
      */
-    template<typename Type, typename Range = std::size_t>
-    using Vector = Internal::VectorDetails<Internal::VectorBase<Type, Range>, Type, Range>;
+    template<typename Type, typename Range = std::size_t, typename GrowthPolicy = DoubleGrowthPolicy>
+    using Vector = Internal::VectorDetails<Internal::VectorBase<Type, Range>, Type, Range, false, GrowthPolicy>;
 
     /** @brief 16 bytes vector with a reduced range */
-    template<typename Type>
-    using TinyVector = Vector<Type, std::uint32_t>;
+    template<typename Type, typename GrowthPolicy = DoubleGrowthPolicy>
+    using TinyVector = Vector<Type, std::uint32_t, GrowthPolicy>;
 }
\ No newline at end of file
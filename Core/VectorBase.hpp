@@ -88,6 +88,18 @@ protected:
     /** @brief Deallocates a buffer */
     void deallocate(Type * const data, const Range) noexcept { Utils::AlignedFree(data); }
 
+    /** @brief Allocates a temporary buffer, used by algorithms requiring scratch memory */
+    [[nodiscard]] static Type *allocateScratch(const Range count) noexcept
+        { return reinterpret_cast<Type *>(Utils::AlignedAlloc<alignof(Type)>(sizeof(Type) * count)); }
+
+    /** @brief Deallocates a temporary buffer */
+    static void deallocateScratch(Type * const data, const Range) noexcept { Utils::AlignedFree(data); }
+
+    /** @brief Resizes a buffer in place if possible, elements are copied bytewise
+     *  @return nullptr if the buffer can't be reallocated, 'data' is then left untouched */
+    [[nodiscard]] Type *reallocate(Type * const data, const Range, const Range capacity) noexcept
+        { return reinterpret_cast<Type *>(Utils::AlignedRealloc(data, sizeof(Type) * capacity, alignof(Type))); }
+
 private:
     Type *_data { nullptr };
     Range _size {};
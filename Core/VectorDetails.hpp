@@ -11,15 +11,16 @@
 #include <stdexcept>
 
 #include "Assert.hpp"
+#include "GrowthPolicy.hpp"
 #include "Utils.hpp"
 
 namespace Core::Internal
 {
-    template<typename Base, typename Type, typename Range, bool IsSmallOptimized = false>
+    template<typename Base, typename Type, typename Range, bool IsSmallOptimized = false, typename GrowthPolicy = DoubleGrowthPolicy>
     class VectorDetails;
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
 class Core::Internal::VectorDetails : public Base
 {
 public:
@@ -169,6 +170,12 @@ public:
     template<typename InputIterator, typename Map>
     Iterator insert(Iterator pos, InputIterator from, InputIterator to, Map &&map);
 
+    /** @brief Construct an element in place at 'pos'
+     *  Arguments must not refer to an element of the vector */
+    template<typename ...Args>
+    Iterator emplace(Iterator pos, Args &&...args)
+        noexcept(nothrow_constructible(Type, Args...) && nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
 
     /** @brief Remove a range of elements */
     void erase(Iterator from, Iterator to)
@@ -218,6 +225,10 @@ public:
      *  @return True if the reserve happened and the data has been moved */
     bool reserve(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 
+    /** @brief Reduce the capacity to the size, the buffer is released if the vector is empty
+     *  @return True if the capacity changed */
+    bool shrinkToFit(void) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
 
     /** @brief Move range [from, to] at [output, to - from] */
     void move(Range from, Range to, Range output) noexcept_ndebug;
@@ -245,7 +256,7 @@ public:
         { return std::find_if(begin(), end(), std::forward<Functor>(functor)); }
 
 
-    /** @brief Grow internal buffer of a given minimum */
+    /** @brief Grow internal buffer of at least a given minimum, the new capacity is computed by the growth policy */
     void grow(const Range minimum = Range()) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 
 protected:
@@ -255,9 +266,25 @@ protected:
     using Base::allocate;
     using Base::deallocate;
 
+    /** @brief Open an uninitialized gap of 'count' elements at 'pos', the size is updated accordingly
+     *  @return Iterator to the beginning of the gap */
+    [[nodiscard]] Iterator openGap(Iterator pos, const Range count)
+        noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
     /** @brief Reserve unsafe takes IsSafe as template parameter */
     template<bool IsSafe = true>
     bool reserveUnsafe(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Move the elements of an allocated vector into a new buffer of 'capacity' (>= size)
+     *  @return False if the buffer did not change (small optimized vector remaining in its cache) */
+    bool reallocateUnsafe(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+};
+
+/** @brief Vectors only point to their heap buffer, except small optimized ones which may point to their cache */
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+struct Core::IsTriviallyRelocatable<Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>>
+{
+    static constexpr bool Value = !IsSmallOptimized;
 };
 
 #include "VectorDetails.ipp"
@@ -3,9 +3,9 @@
  * @ Description: VectorDetails
  */
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<typename ...Args>
-inline std::enable_if_t<std::is_constructible_v<Type, Args...>, Type &> Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::push(Args &&...args)
+inline std::enable_if_t<std::is_constructible_v<Type, Args...>, Type &> Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::push(Args &&...args)
     noexcept(nothrow_constructible(Type, Args...) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (!data())
@@ -19,8 +19,8 @@ inline std::enable_if_t<std::is_constructible_v<Type, Args...>, Type &> Core::In
     return *elem;
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::pop(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::pop(void) noexcept_destructible(Type)
 {
     const Range desiredSize = sizeUnsafe() - static_cast<Range>(1);
 
@@ -28,221 +28,83 @@ inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
     setSize(desiredSize);
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::Iterator
-    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::insertDefault(Iterator pos, const Range count)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insertDefault(Iterator pos, const Range count)
     noexcept(nothrow_default_constructible(Type) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (!count)
         return end();
-    else if (pos == nullptr)  {
-        resize(count);
-        return beginUnsafe();
-    }
-    const auto currentData = dataUnsafe();
-    const Range currentSize = sizeUnsafe();
-    auto currentBegin = beginUnsafe();
-    auto currentEnd = endUnsafe();
-    Range position = pos - currentBegin;
-    if (const Range currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity)  {
-        const Range desiredCapacity = currentCapacity + static_cast<Range>(std::max(currentCapacity, count));
-        const auto tmpData = allocate(desiredCapacity);
-        setData(tmpData);
-        setSize(total);
-        setCapacity(desiredCapacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData) {
-                if (const Range after = currentSize - position; after > count) {
-                    std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-                    std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-                } else
-                    std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-                std::uninitialized_default_construct_n(tmpData + position, count);
-                return tmpData + position;
-            }
-        }
-        std::uninitialized_move_n(currentBegin, position, tmpData);
-        std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
-        std::uninitialized_default_construct_n(tmpData + position, count);
-        deallocate(currentData, currentCapacity);
-        return tmpData + position;
-    } else if (const Range after = currentSize - position; after > count) {
-        std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-        std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-    } else
-        std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-    std::uninitialized_default_construct_n(currentBegin + position, count);
-    setSize(currentSize + count);
-    return currentBegin + position;
+    const auto gap = openGap(pos, count);
+    std::uninitialized_value_construct_n(gap, count);
+    return gap;
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::Iterator
-    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::insertCopy(
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insertCopy(
         Iterator pos, const Range count, const Type &value)
     noexcept(nothrow_copy_constructible(Type) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (!count)
         return end();
-    else if (pos == nullptr)  {
-        resize(count, value);
-        return beginUnsafe();
-    }
-    const auto currentData = dataUnsafe();
-    const Range currentSize = sizeUnsafe();
-    auto currentBegin = beginUnsafe();
-    auto currentEnd = endUnsafe();
-    Range position = pos - currentBegin;
-    if (const Range currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity)  {
-        const Range desiredCapacity = currentCapacity + static_cast<Range>(std::max(currentCapacity, count));
-        const auto tmpData = allocate(desiredCapacity);
-        setData(tmpData);
-        setSize(total);
-        setCapacity(desiredCapacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData) {
-                if (const Range after = currentSize - position; after > count) {
-                    std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-                    std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-                } else
-                    std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-                std::fill_n(tmpData + position, count, value);
-                return tmpData + position;
-            }
-        }
-        std::uninitialized_move_n(currentBegin, position, tmpData);
-        std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
-        std::fill_n(tmpData + position, count, value);
-        deallocate(currentData, currentCapacity);
-        return tmpData + position;
-    } else if (const Range after = currentSize - position; after > count) {
-        std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-        std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-    } else
-        std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-    std::fill_n(currentBegin + position, count, value);
-    setSize(currentSize + count);
-    return currentBegin + position;
+    const auto gap = openGap(pos, count);
+    std::uninitialized_fill_n(gap, count, value);
+    return gap;
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<typename InputIterator>
-inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::Iterator
-    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::insert(
+inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insert(
         Iterator pos, InputIterator from, InputIterator to)
     noexcept(nothrow_forward_iterator_constructible(InputIterator) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     const auto count = static_cast<Range>(std::distance(from, to));
-    Range position;
 
     if (!count)
         return end();
-    else if (pos == Iterator())  {
-        reserve(count);
-        position = 0;
-    } else
-        position = static_cast<Range>(std::distance(beginUnsafe(), pos));
-    const auto currentData = dataUnsafe();
-    const Range currentSize = sizeUnsafe();
-    auto currentBegin = beginUnsafe();
-    auto currentEnd = endUnsafe();
-    if (const Range currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity)  {
-        const Range desiredCapacity = currentCapacity + static_cast<Range>(std::max(currentCapacity, count));
-        const auto tmpData = allocate(desiredCapacity);
-        setData(tmpData);
-        setSize(total);
-        setCapacity(desiredCapacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData) {
-                if (const Range after = currentSize - position; after > count) {
-                    std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-                    std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-                } else
-                    std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-                std::copy(from, to, tmpData + position);
-                return tmpData + position;
-            }
-        }
-        std::uninitialized_move_n(currentBegin, position, tmpData);
-        std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
-        std::copy(from, to, tmpData + position);
-        deallocate(currentData, currentCapacity);
-        return tmpData + position;
-    } else if (const Range after = currentSize - position; after > count) {
-        std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-        std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-    } else
-        std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-    std::copy(from, to, currentBegin + position);
-    setSize(currentSize + count);
-    return currentBegin + position;
+    const auto gap = openGap(pos, count);
+    std::uninitialized_copy(from, to, gap);
+    return gap;
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<typename InputIterator, typename Map>
-inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::Iterator
-    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::insert(
+inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insert(
         Iterator pos, InputIterator from, InputIterator to, Map &&map)
 {
-    constexpr auto MapCopy = [](InputIterator from, InputIterator to, auto &&map, Iterator begin) {
-        while (from != to) {
-            if constexpr (Utils::IsMoveIterator<InputIterator>::Value)
-                new (begin) Type(map(std::move(*from)));
-            else
-                new (begin) Type(map(*from));
-            ++from;
-            ++begin;
-        }
-    };
-
     const auto count = static_cast<Range>(std::distance(from, to));
-    Range position;
 
     if (!count)
         return end();
-    else if (pos == Iterator())  {
-        reserve(count);
-        position = static_cast<Range>(0);
-    } else
-        position = static_cast<Range>(std::distance(beginUnsafe(), pos));
-    const auto currentData = dataUnsafe();
-    const Range currentSize = sizeUnsafe();
-    auto currentBegin = beginUnsafe();
-    auto currentEnd = endUnsafe();
-    if (const Range currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity)  {
-        const Range desiredCapacity = currentCapacity + static_cast<Range>(std::max(currentCapacity, count));
-        const auto tmpData = allocate(desiredCapacity);
-        setData(tmpData);
-        setSize(total);
-        setCapacity(desiredCapacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData) {
-                if (const Range after = currentSize - position; after > count) {
-                    std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-                    std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-                } else
-                    std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-                MapCopy(from, to, std::forward<Map>(map), tmpData + position);
-                return tmpData + position;
-            }
-        }
-        std::uninitialized_move_n(currentBegin, position, tmpData);
-        std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
-        MapCopy(from, to, std::forward<Map>(map), tmpData + position);
-        deallocate(currentData, currentCapacity);
-        return tmpData + position;
-    } else if (const Range after = currentSize - position; after > count) {
-        std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-        std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-    } else
-        std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-    MapCopy(from, to, std::forward<Map>(map), currentBegin + position);
-    setSize(currentSize + count);
-    return currentBegin + position;
+    const auto gap = openGap(pos, count);
+    auto it = gap;
+    while (from != to) {
+        if constexpr (Utils::IsMoveIterator<InputIterator>::Value)
+            new (it) Type(map(std::move(*from)));
+        else
+            new (it) Type(map(*from));
+        ++from;
+        ++it;
+    }
+    return gap;
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::erase(Iterator from, Iterator to)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename ...Args>
+inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::emplace(Iterator pos, Args &&...args)
+    noexcept(nothrow_constructible(Type, Args...) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    const auto gap = openGap(pos, 1);
+    new (gap) Type(std::forward<Args>(args)...);
+    return gap;
+}
+
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::erase(Iterator from, Iterator to)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (from == to)
@@ -250,11 +112,14 @@ inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
     const auto end = endUnsafe();
     setSize(sizeUnsafe() - static_cast<Range>(std::distance(from, to)));
     std::destroy(from, to);
-    std::uninitialized_move(to, end, from);
+    if constexpr (IsTriviallyRelocatable<Type>::Value)
+        Utils::RelocateOverlapping(to, end, from);
+    else
+        std::uninitialized_move(to, end, from);
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::resize(const Range count)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resize(const Range count)
     noexcept(nothrow_default_constructible(Type) && nothrow_destructible(Type))
 {
     if (!count)  {
@@ -270,8 +135,8 @@ inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
     std::uninitialized_value_construct_n(dataUnsafe(), count);
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::resize(const Range count, const Type &value)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resize(const Range count, const Type &value)
     noexcept(nothrow_copy_constructible(Type) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (!count)  {
@@ -287,10 +152,10 @@ inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
     std::uninitialized_fill_n(dataUnsafe(), count, value);
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<typename InputIterator>
 inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<InputIterator>())>, void>
-        Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::resize(InputIterator from, InputIterator to)
+        Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resize(InputIterator from, InputIterator to)
     noexcept(nothrow_forward_iterator_constructible(InputIterator) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     const Range count = static_cast<Range>(std::distance(from, to));
@@ -308,9 +173,9 @@ inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<Inp
     std::uninitialized_copy(from, to, beginUnsafe());
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<typename InputIterator, typename Map>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::resize(InputIterator from, InputIterator to, Map &&map)
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resize(InputIterator from, InputIterator to, Map &&map)
 {
     const auto count = static_cast<Range>(std::distance(from, to));
 
@@ -335,29 +200,29 @@ inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
     }
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::clear(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::clear(void) noexcept_destructible(Type)
 {
     if (data())
         clearUnsafe();
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::clearUnsafe(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::clearUnsafe(void) noexcept_destructible(Type)
 {
     std::destroy_n(dataUnsafe(), sizeUnsafe());
     setSize(0);
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::release(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::release(void) noexcept_destructible(Type)
 {
     if (data())
         releaseUnsafe();
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::releaseUnsafe(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::releaseUnsafe(void) noexcept_destructible(Type)
 {
     const auto currentData = dataUnsafe();
     const Range currentCapacity = capacityUnsafe();
@@ -368,8 +233,8 @@ inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
     deallocate(currentData, currentCapacity);
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::reserve(const Range capacity)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::reserve(const Range capacity)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (data())
@@ -379,29 +244,15 @@ inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
 }
 
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<bool IsSafe>
-inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::reserveUnsafe(const Range capacity)
+inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::reserveUnsafe(const Range capacity)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if constexpr (IsSafe) {
-        const Range currentCapacity = capacityUnsafe();
-        if (currentCapacity >= capacity)
+        if (capacityUnsafe() >= capacity)
             return false;
-        const Range currentSize = sizeUnsafe();
-        const auto currentData = dataUnsafe();
-        const auto tmpData = allocate(capacity);
-        setData(tmpData);
-        setSize(currentSize);
-        setCapacity(capacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData)
-                return false;
-        }
-        std::uninitialized_move_n(currentData, currentSize, tmpData);
-        std::destroy_n(currentData, currentSize);
-        deallocate(currentData, currentCapacity);
-        return true;
+        return reallocateUnsafe(capacity);
     } else {
         if (capacity == 0)
             return false;
@@ -412,30 +263,112 @@ inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
     }
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::grow(const Range minimum)
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::grow(const Range minimum)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    reallocateUnsafe(GrowthPolicy::template NextCapacity<Type, Range>(capacityUnsafe(), minimum));
+}
+
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::shrinkToFit(void)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!data() || sizeUnsafe() == capacityUnsafe())
+        return false;
+    else if (!sizeUnsafe()) {
+        releaseUnsafe();
+        return true;
+    }
+    const Range currentCapacity = capacityUnsafe();
+    reallocateUnsafe(sizeUnsafe());
+    return capacityUnsafe() != currentCapacity;
+}
+
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::reallocateUnsafe(const Range capacity)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     const auto currentData = dataUnsafe();
     const Range currentSize = sizeUnsafe();
     const Range currentCapacity = capacityUnsafe();
-    const Range desiredCapacity = static_cast<Range>(currentCapacity + static_cast<Range>(std::max(currentCapacity, minimum)));
-    const auto tmpData = allocate(desiredCapacity);
 
+    if constexpr (!IsSmallOptimized && IsTriviallyRelocatable<Type>::Value) {
+        if (const auto tmpData = Base::reallocate(currentData, currentCapacity, capacity); tmpData) {
+            setData(tmpData);
+            setCapacity(capacity);
+            return true;
+        }
+    }
+    const auto tmpData = allocate(capacity);
     setData(tmpData);
     setSize(currentSize);
-    setCapacity(desiredCapacity);
+    setCapacity(capacity);
     if constexpr (IsSmallOptimized) {
         if (tmpData == currentData)
-            return;
+            return false;
     }
-    std::uninitialized_move_n(currentData, currentSize, tmpData);
-    std::destroy_n(currentData, currentSize);
+    Utils::RelocateN(currentData, currentSize, tmpData);
     deallocate(currentData, currentCapacity);
+    return true;
+}
+
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline typename Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::openGap(Iterator pos, const Range count)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!data()) {
+        reserveUnsafe<false>(count);
+        setSize(count);
+        return beginUnsafe();
+    }
+    const auto currentData = dataUnsafe();
+    const Range currentSize = sizeUnsafe();
+    const Range currentCapacity = capacityUnsafe();
+    const Range total = currentSize + count;
+    const Range position = pos == Iterator() ? Range() : static_cast<Range>(std::distance(beginUnsafe(), pos));
+
+    if (total > currentCapacity) {
+        const Range desiredCapacity = GrowthPolicy::template NextCapacity<Type, Range>(currentCapacity, count);
+        if constexpr (!IsSmallOptimized && IsTriviallyRelocatable<Type>::Value) {
+            if (const auto tmpData = Base::reallocate(currentData, currentCapacity, desiredCapacity); tmpData) {
+                setData(tmpData);
+                setSize(total);
+                setCapacity(desiredCapacity);
+                Utils::RelocateOverlapping(tmpData + position, tmpData + currentSize, tmpData + position + count);
+                return tmpData + position;
+            }
+        }
+        const auto tmpData = allocate(desiredCapacity);
+        setData(tmpData);
+        setSize(total);
+        setCapacity(desiredCapacity);
+        if (!IsSmallOptimized || tmpData != currentData) {
+            Utils::RelocateN(currentData, position, tmpData);
+            Utils::RelocateN(currentData + position, currentSize - position, tmpData + position + count);
+            deallocate(currentData, currentCapacity);
+            return tmpData + position;
+        }
+    } else
+        setSize(total);
+    const auto begin = currentData + position;
+    const auto end = currentData + currentSize;
+    if constexpr (IsTriviallyRelocatable<Type>::Value)
+        Utils::RelocateOverlapping(begin, end, begin + count);
+    else if (const Range after = currentSize - position; after > count) {
+        std::uninitialized_move(end - count, end, end);
+        std::move_backward(begin, end - count, end);
+        std::destroy_n(begin, count);
+    } else {
+        std::uninitialized_move(begin, end, begin + count);
+        std::destroy(begin, end);
+    }
+    return begin;
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::move(Range from, Range to, Range output) noexcept_ndebug
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::move(Range from, Range to, Range output) noexcept_ndebug
 {
     coreAssert(output < from || output > to,
         throw std::logic_error("VectorDetails::move: Invalid move range"));
@@ -451,8 +384,8 @@ inline void Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::
     std::rotate(it + from, it + to, it + output);
 }
 
-template<typename Base, typename Type, typename Range, bool IsSmallOptimized>
-inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::operator==(const VectorDetails &other) const noexcept
+template<typename Base, typename Type, typename Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::operator==(const VectorDetails &other) const noexcept
 {
     const Range count = size();
     const Range otherCount = other.size();
@@ -0,0 +1,85 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Waiting policies of the lock-free queues
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "Utils.hpp"
+#include "Futex.hpp"
+
+namespace Core
+{
+    struct NoWaitPolicy;
+
+    template<std::uint32_t SpinCount = 1024>
+    class SpinParkWaitPolicy;
+}
+
+/**
+ * @brief The default waiting policy, queues can't block and notifications are free
+ */
+struct Core::NoWaitPolicy
+{
+    /** @brief Tell if the queue supports blocking operations */
+    static constexpr bool IsEnabled = false;
+
+    /** @brief Notifications are no-op */
+    void notifyOne(void) noexcept {}
+    void notifyAll(void) noexcept {}
+};
+
+/**
+ * @brief Adaptive spin then park waiting policy
+ * A waiting thread first spins up to a budget that adapts to the success of previous spins, then parks on a futex
+ * Notifiers only issue a wake-up system call if a thread is actually parked
+ *
+ * @tparam SpinCount Maximum number of tries before parking
+ */
+template<std::uint32_t SpinCount>
+class alignas_cacheline Core::SpinParkWaitPolicy
+{
+public:
+    /** @brief Tell if the queue supports blocking operations */
+    static constexpr bool IsEnabled = true;
+
+    /** @brief Minimum spin budget */
+    static constexpr std::uint32_t MinSpinCount = SpinCount < 16 ? SpinCount : 16;
+
+    /** @brief Block until 'predicate' returns true */
+    template<typename Predicate>
+    void wait(Predicate &&predicate) noexcept(std::is_nothrow_invocable_v<Predicate>);
+
+    /** @brief Block until 'predicate' returns true or 'timeout' expired
+     *  @return The last result of 'predicate' */
+    template<typename Predicate>
+    [[nodiscard]] bool waitFor(Predicate &&predicate, const std::chrono::nanoseconds timeout) noexcept(std::is_nothrow_invocable_v<Predicate>);
+
+    /** @brief Wake a single parked thread, if any */
+    void notifyOne(void) noexcept { notify<false>(); }
+
+    /** @brief Wake all parked threads, if any */
+    void notifyAll(void) noexcept { notify<true>(); }
+
+private:
+    std::atomic<std::uint32_t> _epoch { 0u }; // Incremented each time parked threads are notified
+    std::atomic<std::uint32_t> _waiters { 0u }; // Number of threads about to park or parked
+    std::atomic<std::uint32_t> _spinBudget { SpinCount }; // Adaptive spin budget
+
+    /** @brief Spin over 'predicate' within the adaptive budget */
+    template<typename Predicate>
+    [[nodiscard]] bool spin(Predicate &predicate) noexcept(std::is_nothrow_invocable_v<Predicate>);
+
+    /** @brief Notify implementation */
+    template<bool All>
+    void notify(void) noexcept;
+};
+
+static_assert_sizeof(Core::NoWaitPolicy, 1);
+static_assert_fit_cacheline(Core::SpinParkWaitPolicy<>);
+
+#include "WaitPolicy.ipp"
@@ -0,0 +1,91 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Waiting policies of the lock-free queues
+ */
+
+template<std::uint32_t SpinCount>
+template<typename Predicate>
+inline void Core::SpinParkWaitPolicy<SpinCount>::wait(Predicate &&predicate) noexcept(std::is_nothrow_invocable_v<Predicate>)
+{
+    if (spin(predicate))
+        return;
+    while (true) {
+        // The waiter count must be visible before the predicate is checked (pairs with the fence of 'notify')
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto epoch = _epoch.load(std::memory_order_relaxed);
+        if (predicate()) {
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+        Utils::FutexWait(_epoch, epoch);
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        if (predicate())
+            return;
+    }
+}
+
+template<std::uint32_t SpinCount>
+template<typename Predicate>
+inline bool Core::SpinParkWaitPolicy<SpinCount>::waitFor(Predicate &&predicate, const std::chrono::nanoseconds timeout)
+    noexcept(std::is_nothrow_invocable_v<Predicate>)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    if (spin(predicate))
+        return true;
+    while (true) {
+        const auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::nanoseconds::zero())
+            return predicate();
+        _waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto epoch = _epoch.load(std::memory_order_relaxed);
+        if (predicate()) {
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        const bool woken = Utils::FutexWaitFor(_epoch, epoch, std::chrono::duration_cast<std::chrono::nanoseconds>(remaining));
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+        if (predicate())
+            return true;
+        else if (!woken)
+            return false;
+    }
+}
+
+template<std::uint32_t SpinCount>
+template<typename Predicate>
+inline bool Core::SpinParkWaitPolicy<SpinCount>::spin(Predicate &predicate) noexcept(std::is_nothrow_invocable_v<Predicate>)
+{
+    const auto budget = _spinBudget.load(std::memory_order_relaxed);
+
+    for (auto i = 0u; i < budget; ++i) {
+        if (predicate()) {
+            // Spinning paid off, allow longer spins
+            if (budget != SpinCount)
+                _spinBudget.store(std::min(SpinCount, budget * 2), std::memory_order_relaxed);
+            return true;
+        }
+        Utils::CpuRelax();
+    }
+    // Spinning was a waste, park sooner next time
+    if (budget != MinSpinCount)
+        _spinBudget.store(std::max(MinSpinCount, budget / 2), std::memory_order_relaxed);
+    return false;
+}
+
+template<std::uint32_t SpinCount>
+template<bool All>
+inline void Core::SpinParkWaitPolicy<SpinCount>::notify(void) noexcept
+{
+    // The queue update must be visible before the waiter count is checked (pairs with the fence of 'wait')
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!_waiters.load(std::memory_order_relaxed))
+        return;
+    _epoch.fetch_add(1, std::memory_order_relaxed);
+    if constexpr (All)
+        Utils::FutexWakeAll(_epoch);
+    else
+        Utils::FutexWakeOne(_epoch);
+}
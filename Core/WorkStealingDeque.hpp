@@ -0,0 +1,72 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Work-stealing deque
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    template<typename Type>
+    class WorkStealingDeque;
+}
+
+/**
+ * @brief Chase-Lev work-stealing deque with a fixed capacity (C11 formulation of Lê et al.)
+ * The owner thread pushes and pops at the bottom (LIFO) while any other thread steals from the top (FIFO)
+ *
+ * @tparam Type to be inserted, must be trivially copyable (usually a pointer)
+ */
+template<typename Type>
+class alignas_double_cacheline Core::WorkStealingDeque
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type>, "Core::WorkStealingDeque: Type must be trivially copyable");
+
+    /** @brief Buffer structure containing all cells */
+    struct Buffer
+    {
+        std::int64_t mask { 0 };
+        std::atomic<Type> *data { nullptr };
+    };
+
+    /** @brief Default constructor initialize the deque, capacity must be a power of 2 */
+    WorkStealingDeque(const std::size_t capacity);
+
+    /** @brief Release all memory */
+    ~WorkStealingDeque(void) noexcept { Utils::AlignedFree(_buffer.data); }
+
+    /** @brief Push an element at the bottom of the deque (owner only)
+     *  @return true if the element has been inserted */
+    [[nodiscard]] bool push(const Type value) noexcept;
+
+    /** @brief Pop an element from the bottom of the deque (owner only)
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool pop(Type &value) noexcept;
+
+    /** @brief Steal an element from the top of the deque (any thread)
+     *  @return true if an element has been extracted */
+    [[nodiscard]] bool steal(Type &value) noexcept;
+
+    /** @brief Get the approximative size of the deque */
+    [[nodiscard]] std::size_t size(void) const noexcept;
+
+private:
+    alignas_cacheline std::atomic<std::int64_t> _top { 0 }; // Top accessed by thieves and owner
+    alignas_cacheline std::atomic<std::int64_t> _bottom { 0 }; // Bottom accessed by owner and read by thieves
+    Buffer _buffer {};
+
+    /** @brief Copy and move constructors disabled */
+    WorkStealingDeque(const WorkStealingDeque &other) = delete;
+    WorkStealingDeque(WorkStealingDeque &&other) = delete;
+};
+
+static_assert_sizeof(Core::WorkStealingDeque<void *>, 2 * Core::CacheLineSize);
+static_assert_alignof_double_cacheline(Core::WorkStealingDeque<void *>);
+
+#include "WorkStealingDeque.ipp"
@@ -0,0 +1,76 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Work-stealing deque
+ */
+
+#include <stdexcept>
+
+template<typename Type>
+inline Core::WorkStealingDeque<Type>::WorkStealingDeque(const std::size_t capacity)
+    : _buffer(Buffer { static_cast<std::int64_t>(capacity) - 1, nullptr })
+{
+    if (!((capacity >= 2) && ((capacity & (capacity - 1)) == 0)))
+        throw std::invalid_argument("Core::WorkStealingDeque: Buffer capacity must be a power of 2");
+    else if (_buffer.data = Utils::AlignedAlloc<alignof(std::atomic<Type>), std::atomic<Type>>(sizeof(std::atomic<Type>) * capacity); !_buffer.data)
+        throw std::runtime_error("Core::WorkStealingDeque: Malloc failed");
+    for (auto i = 0ul; i < capacity; ++i)
+        new (&_buffer.data[i]) std::atomic<Type>();
+}
+
+template<typename Type>
+inline bool Core::WorkStealingDeque<Type>::push(const Type value) noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_acquire);
+
+    if (bottom - top > _buffer.mask)
+        return false;
+    _buffer.data[bottom & _buffer.mask].store(value, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+template<typename Type>
+inline bool Core::WorkStealingDeque<Type>::pop(Type &value) noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = _top.load(std::memory_order_relaxed);
+    if (top > bottom) {
+        // Empty deque
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    value = _buffer.data[bottom & _buffer.mask].load(std::memory_order_relaxed);
+    if (top != bottom)
+        return true;
+    // Last element, race against thieves
+    const bool success = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return success;
+}
+
+template<typename Type>
+inline bool Core::WorkStealingDeque<Type>::steal(Type &value) noexcept
+{
+    auto top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+        return false;
+    value = _buffer.data[top & _buffer.mask].load(std::memory_order_relaxed);
+    return _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
+
+template<typename Type>
+inline std::size_t Core::WorkStealingDeque<Type>::size(void) const noexcept
+{
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_relaxed);
+
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0ul;
+}
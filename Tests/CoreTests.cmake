@@ -7,15 +7,28 @@ get_filename_component(CoreTestsDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 set(CoreTestsSources
     ${CoreTestsDir}/tests_Vector.cpp
     ${CoreTestsDir}/tests_SortedVector.cpp
+    ${CoreTestsDir}/tests_EytzingerArray.cpp
+    ${CoreTestsDir}/tests_SortedFlatMap.cpp
+    ${CoreTestsDir}/tests_SoAVector.cpp
     ${CoreTestsDir}/tests_FlatString.cpp
+    ${CoreTestsDir}/tests_FlatHashMap.cpp
+    ${CoreTestsDir}/tests_Hash.cpp
     ${CoreTestsDir}/tests_HeapArray.cpp
+    ${CoreTestsDir}/tests_LargeAlloc.cpp
     ${CoreTestsDir}/tests_UniqueAlloc.cpp
+    ${CoreTestsDir}/tests_Arena.cpp
+    ${CoreTestsDir}/tests_PoolResource.cpp
     ${CoreTestsDir}/tests_Functor.cpp
     ${CoreTestsDir}/tests_TrivialFunctor.cpp
     ${CoreTestsDir}/tests_String.cpp
     ${CoreTestsDir}/tests_Dispatcher.cpp
     ${CoreTestsDir}/tests_SPSCQueue.cpp
+    ${CoreTestsDir}/tests_SPSCUnboundedQueue.cpp
+    ${CoreTestsDir}/tests_BroadcastRing.cpp
     ${CoreTestsDir}/tests_MPMCQueue.cpp
+    ${CoreTestsDir}/tests_MPSCQueue.cpp
+    ${CoreTestsDir}/tests_WorkStealingDeque.cpp
+    ${CoreTestsDir}/tests_Scheduler.cpp
 )
 
 add_executable(${PROJECT_NAME} ${CoreTestsSources})
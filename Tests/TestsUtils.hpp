@@ -0,0 +1,24 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Helpers shared by the unit tests
+ */
+
+#pragma once
+
+namespace Tests
+{
+    /** @brief Count live instances to detect leaks and double destructions */
+    struct Counted
+    {
+        static inline int Alive = 0;
+
+        Counted(const int value_ = 0) noexcept : value(value_) { ++Alive; }
+        Counted(const Counted &other) noexcept : value(other.value) { ++Alive; }
+        Counted(Counted &&other) noexcept : value(other.value) { ++Alive; }
+        ~Counted(void) noexcept { --Alive; }
+        Counted &operator=(const Counted &other) noexcept = default;
+        Counted &operator=(Counted &&other) noexcept = default;
+
+        int value;
+    };
+}
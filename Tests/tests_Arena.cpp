@@ -0,0 +1,100 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the arena allocators
+ */
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Core/Arena.hpp>
+#include <Core/AllocatedVector.hpp>
+
+using namespace Core;
+
+TEST(Arena, Basics)
+{
+    Arena arena(1024);
+
+    ASSERT_EQ(arena.reservedBytes(), 0);
+    const auto first = arena.allocate(10, 1);
+    const auto second = arena.allocate(sizeof(std::size_t), alignof(std::size_t));
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignof(std::size_t), 0);
+    ASSERT_EQ(reinterpret_cast<std::byte *>(second) - reinterpret_cast<std::byte *>(first), 16);
+    const auto aligned = arena.allocate(32, 256);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 256, 0);
+    ASSERT_EQ(arena.reservedBytes(), 1024);
+    // Allocations larger than a chunk get their own chunk
+    const auto large = arena.allocate(4096, 1);
+    ASSERT_NE(large, nullptr);
+    ASSERT_EQ(arena.reservedBytes(), 1024 + 4096);
+    // Reset reuses the same chunks without allocating
+    arena.reset();
+    ASSERT_EQ(arena.allocate(10, 1), first);
+    ASSERT_EQ(arena.allocate(4096, 1), large);
+    ASSERT_EQ(arena.reservedBytes(), 1024 + 4096);
+}
+
+TEST(Arena, Rewind)
+{
+    Arena arena(256);
+
+    const auto first = arena.allocate(64, 1);
+    void *scoped = nullptr;
+    {
+        Arena::Scope scope(arena);
+        scoped = arena.allocate(64, 1);
+        // Spill over multiple chunks
+        for (auto i = 0; i < 16; ++i)
+            ASSERT_NE(arena.allocate(64, 1), nullptr);
+    }
+    ASSERT_EQ(arena.allocate(64, 1), scoped);
+    const auto marker = arena.mark();
+    const auto last = arena.allocate(64, 1);
+    arena.rewind(marker);
+    ASSERT_EQ(arena.allocate(64, 1), last);
+    arena.reset();
+    ASSERT_EQ(arena.allocate(64, 1), first);
+}
+
+TEST(Arena, AllocatedVector)
+{
+    using ScratchVector = AllocatedVector<std::string, &ArenaAlloc, &ArenaFree>;
+
+    const auto reserved = Arena::Local().reservedBytes();
+    {
+        Arena::Scope scope(Arena::Local());
+        ScratchVector vector;
+        for (auto i = 0; i < 100; ++i)
+            vector.push(std::to_string(i));
+        for (auto i = 0u; i < 100u; ++i)
+            ASSERT_EQ(vector[i], std::to_string(i));
+    }
+    // Each thread has its own arena
+    std::thread([] {
+        ASSERT_EQ(Arena::Local().reservedBytes(), 0);
+        ASSERT_NE(ArenaAlloc(16, 16), nullptr);
+        ASSERT_EQ(Arena::Local().reservedBytes(), Arena::DefaultChunkSize);
+    }).join();
+    ASSERT_GE(Arena::Local().reservedBytes(), reserved);
+}
+
+TEST(Arena, FrameArena)
+{
+    FrameArena arena(1024);
+
+    const auto first = arena.allocate(64, 1);
+    arena.nextFrame();
+    const auto second = arena.allocate(64, 1);
+    // Allocations of the previous frame are still valid
+    ASSERT_NE(first, second);
+    arena.nextFrame();
+    ASSERT_EQ(arena.allocate(64, 1), first);
+    arena.nextFrame();
+    ASSERT_EQ(arena.allocate(64, 1), second);
+    ASSERT_EQ(arena.frame(), 3);
+    ASSERT_NE(FrameAlloc(16, 16), nullptr);
+    FrameArena::Local().nextFrame();
+}
@@ -0,0 +1,150 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the broadcast ring buffer
+ */
+
+#include <array>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Core/Assert.hpp>
+#include <Core/BroadcastRing.hpp>
+
+using Block = std::array<float, 32>;
+
+static Block MakeBlock(const std::size_t index) noexcept
+{
+    Block block;
+    block.fill(static_cast<float>(index));
+    return block;
+}
+
+TEST(BroadcastRing, Basics)
+{
+    constexpr std::size_t ringSize = 8;
+
+    Core::BroadcastRing<Block> ring(ringSize, 2);
+    Block block;
+
+    const auto first = ring.subscribe();
+    const auto second = ring.subscribe();
+    ASSERT_THROW((void)ring.subscribe(), std::runtime_error);
+    ASSERT_FALSE(ring.pop(first, block));
+    for (auto i = 0ul; i < 4; ++i)
+        ASSERT_TRUE(ring.push(MakeBlock(i)));
+    ASSERT_EQ(ring.size(first), 4);
+    // Each reader sees every element
+    for (const auto reader : { first, second }) {
+        for (auto i = 0ul; i < 4; ++i) {
+            ASSERT_TRUE(ring.pop(reader, block));
+            ASSERT_EQ(block, MakeBlock(i));
+        }
+        ASSERT_FALSE(ring.pop(reader, block));
+        ASSERT_EQ(ring.lostCount(reader), 0);
+    }
+    ring.unsubscribe(second);
+    const auto third = ring.subscribe();
+    ASSERT_EQ(third, second);
+    ASSERT_EQ(ring.size(third), 0);
+}
+
+TEST(BroadcastRing, Overrun)
+{
+    constexpr std::size_t ringSize = 8;
+
+    Core::BroadcastRing<Block> ring(ringSize, 1);
+    Block block;
+
+    const auto reader = ring.subscribe();
+    for (auto i = 0ul; i < ringSize * 3; ++i)
+        ASSERT_TRUE(ring.push(MakeBlock(i)));
+    ASSERT_EQ(ring.size(reader), ringSize);
+    // The reader resumes at the oldest element which cannot be overwritten by the next push
+    ASSERT_TRUE(ring.pop(reader, block));
+    ASSERT_EQ(block, MakeBlock(ringSize * 2 + 1));
+    ASSERT_EQ(ring.lostCount(reader), ringSize * 2 + 1);
+    for (auto i = ringSize * 2 + 2; i < ringSize * 3; ++i) {
+        ASSERT_TRUE(ring.pop(reader, block));
+        ASSERT_EQ(block, MakeBlock(i));
+    }
+    ASSERT_FALSE(ring.pop(reader, block));
+}
+
+TEST(BroadcastRing, WaitSlowestReader)
+{
+    constexpr std::size_t ringSize = 8;
+
+    Core::BroadcastRing<Block, Core::WaitSlowestReader> ring(ringSize, 2);
+    Block block;
+
+    const auto fast = ring.subscribe();
+    const auto slow = ring.subscribe();
+    for (auto i = 0ul; i < ringSize; ++i)
+        ASSERT_TRUE(ring.push(MakeBlock(i)));
+    for (auto i = 0ul; i < ringSize; ++i)
+        ASSERT_TRUE(ring.pop(fast, block));
+    ASSERT_FALSE(ring.push(MakeBlock(ringSize)));
+    ASSERT_TRUE(ring.pop(slow, block));
+    ASSERT_EQ(block, MakeBlock(0));
+    ASSERT_TRUE(ring.push(MakeBlock(ringSize)));
+    ASSERT_FALSE(ring.push(MakeBlock(ringSize + 1)));
+    ring.unsubscribe(slow);
+    ASSERT_TRUE(ring.push(MakeBlock(ringSize + 1)));
+    ASSERT_EQ(ring.lostCount(fast), 0);
+}
+
+TEST(BroadcastRing, IntensiveThreading)
+{
+    constexpr auto ReaderCount = 3;
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 32768;
+    constexpr std::size_t ringSize = 16;
+
+    Core::BroadcastRing<Block> overwriteRing(ringSize, ReaderCount);
+    Core::BroadcastRing<Block, Core::WaitSlowestReader> waitRing(ringSize, ReaderCount);
+    std::thread readers[ReaderCount * 2];
+    std::atomic<std::size_t> readyCount { 0 };
+
+    for (auto i = 0; i < ReaderCount; ++i) {
+        // Overwriting readers receive an increasing sequence of untorn blocks, with gaps
+        readers[i] = std::thread([&] {
+            const auto reader = overwriteRing.subscribe();
+            std::size_t received = 0, next = 0;
+            Block block;
+            ++readyCount;
+            while (next < Counter) {
+                if (!overwriteRing.pop(reader, block)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                const auto index = static_cast<std::size_t>(block.front());
+                ASSERT_EQ(block, MakeBlock(index));
+                ASSERT_GE(index, next);
+                next = index + 1;
+                ++received;
+            }
+            ASSERT_EQ(received + overwriteRing.lostCount(reader), Counter);
+        });
+        // Waiting readers receive every block
+        readers[ReaderCount + i] = std::thread([&] {
+            const auto reader = waitRing.subscribe();
+            Block block;
+            ++readyCount;
+            for (auto i = 0ul; i < Counter; ++i) {
+                while (!waitRing.pop(reader, block))
+                    std::this_thread::yield();
+                ASSERT_EQ(block, MakeBlock(i));
+            }
+            ASSERT_EQ(waitRing.lostCount(reader), 0);
+        });
+    }
+    while (readyCount != ReaderCount * 2)
+        std::this_thread::yield();
+    for (auto i = 0ul; i < Counter; ++i) {
+        ASSERT_TRUE(overwriteRing.push(MakeBlock(i)));
+        while (!waitRing.push(MakeBlock(i)))
+            std::this_thread::yield();
+    }
+    for (auto &reader : readers)
+        reader.join();
+}
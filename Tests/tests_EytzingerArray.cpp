@@ -0,0 +1,68 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the Eytzinger array
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Core/EytzingerArray.hpp>
+#include <Core/SortedVector.hpp>
+
+using namespace Core;
+
+TEST(EytzingerArray, Empty)
+{
+    EytzingerArray<int> array;
+
+    ASSERT_TRUE(array.empty());
+    ASSERT_EQ(array.lowerBound(42), nullptr);
+    ASSERT_EQ(array.upperBound(42), nullptr);
+    ASSERT_FALSE(array.contains(42));
+}
+
+TEST(EytzingerArray, MatchesBinarySearch)
+{
+    for (auto count = 1; count < 300; count += 7) {
+        SortedVector<int> sorted;
+        for (auto i = 0; i < count; ++i)
+            sorted.push((i / 2) * 3);
+        const EytzingerArray<int> array(sorted);
+        ASSERT_EQ(array.size(), static_cast<std::size_t>(count));
+        for (auto value = -1; value <= count * 2; ++value) {
+            const auto lower = std::lower_bound(sorted.begin(), sorted.end(), value);
+            const auto upper = std::upper_bound(sorted.begin(), sorted.end(), value);
+            const auto eytzingerLower = array.lowerBound(value);
+            const auto eytzingerUpper = array.upperBound(value);
+            ASSERT_EQ(eytzingerLower == nullptr, lower == sorted.end());
+            ASSERT_EQ(eytzingerUpper == nullptr, upper == sorted.end());
+            if (eytzingerLower) {
+                ASSERT_EQ(*eytzingerLower, *lower);
+            }
+            if (eytzingerUpper) {
+                ASSERT_EQ(*eytzingerUpper, *upper);
+            }
+            ASSERT_EQ(array.contains(value), std::binary_search(sorted.begin(), sorted.end(), value));
+        }
+    }
+}
+
+TEST(EytzingerArray, Semantics)
+{
+    std::vector<std::string> names { "Attack", "Decay", "Release", "Sustain" };
+    EytzingerArray<std::string> array(names.begin(), names.end());
+    auto copy = array;
+    const auto moved = std::move(array);
+
+    ASSERT_TRUE(array.empty());
+    ASSERT_EQ(copy.size(), 4);
+    ASSERT_EQ(*moved.find(std::string("Release")), "Release");
+    ASSERT_EQ(moved.find(std::string("Gain")), nullptr);
+    copy.build(std::make_move_iterator(names.begin()), std::make_move_iterator(names.begin() + 2));
+    ASSERT_EQ(copy.size(), 2);
+    ASSERT_TRUE(copy.contains(std::string("Decay")));
+    ASSERT_FALSE(copy.contains(std::string("Sustain")));
+}
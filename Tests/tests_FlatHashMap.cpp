@@ -0,0 +1,262 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the flat hash map and set
+ */
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <Core/AllocatedFlatHashMap.hpp>
+#include <Core/Arena.hpp>
+#include <Core/FlatHashMap.hpp>
+#include <Core/FlatHashSet.hpp>
+#include <Core/String.hpp>
+
+#include "TestsUtils.hpp"
+
+using namespace Core;
+using namespace Core::Literal;
+
+using Tests::Counted;
+
+namespace
+{
+    /** @brief Counted value whose construction throws on negative input */
+    struct ThrowingValue : Counted
+    {
+        ThrowingValue(const int input) : Counted(input) { if (input < 0) throw std::invalid_argument("ThrowingValue"); }
+    };
+}
+
+TEST(FlatHashMap, Basics)
+{
+    FlatHashMap<int, int> map;
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.find(42), map.end());
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_FALSE(map.erase(42));
+    for (auto i = 0; i < 1000; ++i)
+        ASSERT_TRUE(map.tryEmplace(i, i * 2).second);
+    ASSERT_FALSE(map.tryEmplace(10, 0).second);
+    ASSERT_EQ(map.size(), 1000);
+    for (auto i = 0; i < 1000; ++i) {
+        const auto it = map.find(i);
+        ASSERT_NE(it, map.end());
+        ASSERT_EQ(it->first, i);
+        ASSERT_EQ(it->second, i * 2);
+    }
+    ASSERT_FALSE(map.contains(1000));
+    ASSERT_EQ(map.at(10), 20);
+    map[10] = 42;
+    ASSERT_EQ(map[10], 42);
+    ASSERT_EQ(map[2000], 0);
+    ASSERT_FALSE(map.insertOrAssign(2000, 1).second);
+    ASSERT_EQ(map.at(2000), 1);
+    ASSERT_TRUE(map.insert(std::make_pair(3000, 3)).second);
+    auto sum = 0ul;
+    for (const auto &pair : map)
+        sum += static_cast<std::size_t>(pair.first);
+    ASSERT_EQ(sum, 999ul * 1000ul / 2ul + 2000ul + 3000ul);
+    // Keys are constant through iterators, values are not
+    static_assert(std::is_const_v<std::remove_reference_t<decltype(map.begin()->first)>>);
+    static_assert(!std::is_const_v<std::remove_reference_t<decltype(map.begin()->second)>>);
+    static_assert(std::is_const_v<std::remove_reference_t<decltype(std::as_const(map).begin()->second)>>);
+    for (auto [key, value] : map)
+        value = key;
+    ASSERT_EQ(map.at(3000), 3000);
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_NE(map.capacity(), 0);
+    map.release();
+    ASSERT_EQ(map.capacity(), 0);
+}
+
+TEST(FlatHashMap, HeterogeneousLookup)
+{
+    FlatHashMap<String, int> map;
+
+    map.tryEmplace(std::string_view("Oscillator"), 1);
+    map.tryEmplace("Filter", 2);
+    map[std::string_view("Envelope")] = 3;
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(map.at(std::string_view("Oscillator")), 1);
+    ASSERT_EQ(map.at("Filter"), 2);
+    ASSERT_EQ(map.at(String("Envelope")), 3);
+    ASSERT_EQ(map.at(std::string("Envelope")), 3);
+    ASSERT_FALSE(map.contains(std::string_view("Osc")));
+    ASSERT_TRUE(map.erase(std::string_view("Filter")));
+    ASSERT_FALSE(map.contains("Filter"));
+}
+
+TEST(FlatHashMap, HashedNameKeys)
+{
+    FlatHashMap<HashedName, int> map;
+
+    map["Gain"_hash] = 1;
+    map["Pan"_hash] = 2;
+    ASSERT_EQ(map.at("Gain"_hash), 1);
+    ASSERT_EQ(map.at(Hash(std::string_view("Pan"))), 2);
+    ASSERT_FALSE(map.contains("Volume"_hash));
+}
+
+TEST(FlatHashMap, EraseWhileIterating)
+{
+    FlatHashMap<int, Counted> map;
+
+    for (auto i = 0; i < 500; ++i)
+        map.tryEmplace(i, i);
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        if (it->first % 2)
+            map.erase(it);
+    }
+    ASSERT_EQ(map.size(), 250);
+    ASSERT_EQ(Counted::Alive, 250);
+    for (auto i = 0; i < 500; ++i)
+        ASSERT_EQ(map.contains(i), !(i % 2));
+    map.release();
+    ASSERT_EQ(Counted::Alive, 0);
+}
+
+TEST(FlatHashMap, CopyMove)
+{
+    FlatHashMap<std::string, Counted> map;
+
+    for (auto i = 0; i < 100; ++i)
+        map.tryEmplace(std::to_string(i), i);
+    {
+        auto copy = map;
+        ASSERT_EQ(copy.size(), 100);
+        ASSERT_EQ(Counted::Alive, 200);
+        for (auto i = 0; i < 100; ++i)
+            ASSERT_EQ(copy.at(std::to_string(i)).value, i);
+        auto moved = std::move(copy);
+        ASSERT_TRUE(copy.empty());
+        ASSERT_EQ(moved.size(), 100);
+        copy = moved;
+        ASSERT_EQ(Counted::Alive, 300);
+    }
+    ASSERT_EQ(Counted::Alive, 100);
+    map = FlatHashMap<std::string, Counted> { { "a", 1 }, { "b", 2 } };
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(Counted::Alive, 2);
+}
+
+TEST(FlatHashMap, ThrowingInsert)
+{
+    {
+        FlatHashMap<int, ThrowingValue> map;
+
+        for (auto i = 0; i < 20; ++i)
+            map.tryEmplace(i * 2, i);
+        const auto capacity = map.capacity();
+        ASSERT_THROW(map.tryEmplace(7, -1), std::invalid_argument);
+        ASSERT_THROW(map.insertOrAssign(9, -1), std::invalid_argument);
+        // Failed insertions must not leave a claimed slot behind
+        ASSERT_EQ(map.size(), 20);
+        ASSERT_EQ(map.capacity(), capacity);
+        ASSERT_EQ(Counted::Alive, 20);
+        ASSERT_FALSE(map.contains(7));
+        ASSERT_FALSE(map.contains(9));
+        for (auto i = 0; i < 20; ++i)
+            ASSERT_EQ(map.at(i * 2).value, i);
+        map.tryEmplace(7, 7);
+        ASSERT_EQ(map.at(7).value, 7);
+    }
+    ASSERT_EQ(Counted::Alive, 0);
+}
+
+TEST(FlatHashMap, Reserve)
+{
+    FlatHashMap<int, int> map;
+
+    map.reserve(1000);
+    const auto capacity = map.capacity();
+    ASSERT_GE(capacity, 1000);
+    for (auto i = 0; i < 1000; ++i)
+        map.tryEmplace(i, i);
+    ASSERT_EQ(map.capacity(), capacity);
+    // Erasing and inserting reuses the deleted slots instead of growing
+    for (auto round = 1; round < 100; ++round) {
+        for (auto i = 0; i < 1000; ++i)
+            ASSERT_TRUE(map.erase(i + (round - 1) * 1000));
+        for (auto i = 0; i < 1000; ++i)
+            map.tryEmplace(i + round * 1000, i);
+    }
+    ASSERT_EQ(map.size(), 1000);
+    ASSERT_EQ(map.capacity(), capacity);
+}
+
+TEST(FlatHashMap, Random)
+{
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> keys(0, 4096), actions(0, 3);
+    FlatHashMap<int, int> map;
+    std::unordered_map<int, int> reference;
+
+    for (auto i = 0; i < 100000; ++i) {
+        const auto key = keys(engine);
+        switch (actions(engine)) {
+        case 0:
+            ASSERT_EQ(map.erase(key), reference.erase(key) == 1);
+            break;
+        case 1:
+            ASSERT_EQ(map.tryEmplace(key, i).second, reference.try_emplace(key, i).second);
+            break;
+        case 2:
+            map.insertOrAssign(key, i);
+            reference.insert_or_assign(key, i);
+            break;
+        default:
+            ASSERT_EQ(map.contains(key), reference.contains(key));
+            break;
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+    for (const auto &[key, value] : reference)
+        ASSERT_EQ(map.at(key), value);
+    auto count = 0ul;
+    for (const auto &pair : map) {
+        ASSERT_EQ(reference.at(pair.first), pair.second);
+        ++count;
+    }
+    ASSERT_EQ(count, reference.size());
+}
+
+TEST(FlatHashMap, Allocated)
+{
+    using ScratchMap = AllocatedFlatHashMap<int, int, &ArenaAlloc, &ArenaFree>;
+
+    Arena::Scope scope(Arena::Local());
+    ScratchMap map;
+
+    for (auto i = 0; i < 1000; ++i)
+        map[i] = i;
+    for (auto i = 0; i < 1000; ++i)
+        ASSERT_EQ(map.at(i), i);
+}
+
+TEST(FlatHashSet, Basics)
+{
+    FlatHashSet<String> set { String("Gain"), String("Pan") };
+
+    ASSERT_EQ(set.size(), 2);
+    ASSERT_TRUE(set.insert(String("Volume")).second);
+    ASSERT_FALSE(set.tryEmplace(std::string_view("Gain")).second);
+    ASSERT_TRUE(set.contains("Volume"));
+    ASSERT_TRUE(set.contains(std::string_view("Pan")));
+    ASSERT_EQ(*set.find("Gain"), "Gain");
+    ASSERT_TRUE(set.erase("Gain"));
+    ASSERT_EQ(set.size(), 2);
+    auto count = 0;
+    for (const auto &str : set) {
+        ASSERT_TRUE(str == "Pan" || str == "Volume");
+        ++count;
+    }
+    ASSERT_EQ(count, 2);
+}
@@ -0,0 +1,152 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the hash function
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Core/Hash.hpp>
+
+using namespace Core;
+using namespace Core::Literal;
+
+namespace
+{
+    constexpr std::size_t BufferSize = 1100;
+
+    /** @brief Lengths covering every path of the hash function */
+    constexpr std::array<std::size_t, 16> Lengths = { 0, 1, 3, 4, 7, 8, 15, 16, 17, 48, 49, 100, 256, 257, 577, BufferSize };
+
+    /** @brief Deterministic bytes, including negative chars */
+    [[nodiscard]] constexpr std::array<char, BufferSize> MakeBuffer(void) noexcept
+    {
+        std::array<char, BufferSize> buffer {};
+        std::uint32_t state = 0x12345678u;
+
+        for (auto &c : buffer) {
+            state = state * 1664525u + 1013904223u;
+            c = static_cast<char>(state >> 24);
+        }
+        return buffer;
+    }
+
+    constexpr auto Buffer = MakeBuffer();
+
+    /** @brief Hashes of every prefix length computed at compile-time */
+    constexpr auto CompileTimeHashes = [] {
+        std::array<HashedName, Lengths.size()> hashes {};
+        for (auto i = 0ul; i < Lengths.size(); ++i)
+            hashes[i] = Hash(Buffer.data(), Lengths[i]);
+        return hashes;
+    }();
+
+    /** @brief Identifiers as they are built by the application: modules, parameters and automations */
+    [[nodiscard]] std::vector<std::string> MakeIdentifiers(void)
+    {
+        constexpr const char *Modules[] = {
+            "Oscillator", "Sampler", "Mixer", "Filter", "Envelope", "LFO", "Delay", "Reverb",
+            "Compressor", "Equalizer", "Arpeggiator", "Sequencer", "Chorus", "Distortion", "Gain", "Panner"
+        };
+        constexpr const char *Parameters[] = {
+            "Volume", "Pan", "Cutoff", "Resonance", "Attack", "Decay", "Sustain", "Release",
+            "Frequency", "Detune", "Mix", "Feedback", "Ratio", "Threshold", "Rate", "Depth"
+        };
+        std::vector<std::string> identifiers;
+
+        for (const auto module : Modules) {
+            identifiers.emplace_back(module);
+            for (auto voice = 0; voice < 64; ++voice) {
+                for (const auto parameter : Parameters) {
+                    identifiers.emplace_back(std::string(module) + parameter + std::to_string(voice));
+                    identifiers.emplace_back(std::string(module) + '/' + std::to_string(voice) + '/' + parameter);
+                    identifiers.emplace_back("Project/Track" + std::to_string(voice) + '/' + module + "/Automation/" + parameter);
+                }
+            }
+        }
+        for (auto i = 0; i < 4096; ++i)
+            identifiers.emplace_back(std::to_string(i));
+        std::sort(identifiers.begin(), identifiers.end());
+        identifiers.erase(std::unique(identifiers.begin(), identifiers.end()), identifiers.end());
+        return identifiers;
+    }
+}
+
+TEST(Hash, Literal)
+{
+    constexpr auto hash = "Oscillator/Voice/Filter/Cutoff"_hash;
+
+    ASSERT_EQ(hash, Hash(std::string_view("Oscillator/Voice/Filter/Cutoff")));
+    ASSERT_EQ(Hash('a'), "a"_hash);
+    ASSERT_NE(""_hash, "a"_hash);
+    ASSERT_NE(Hash("abc", 3, 0), Hash("abc", 3, 1));
+}
+
+TEST(Hash, CompileTimeMatchesRuntime)
+{
+    // The runtime path reads words and accumulates long inputs with SIMD instructions
+    for (auto i = 0ul; i < Lengths.size(); ++i) {
+        const std::string copy(Buffer.data(), Lengths[i]);
+        ASSERT_EQ(Hash(copy.data(), copy.size()), CompileTimeHashes[i]) << "Length " << Lengths[i];
+    }
+}
+
+TEST(Hash, AllLengths)
+{
+    std::unordered_set<HashedName> hashes;
+
+    // Every prefix of the buffer gives a distinct hash, whatever its alignment
+    for (auto length = 0ul; length <= BufferSize; ++length) {
+        const auto hash = Hash(Buffer.data(), length);
+        ASSERT_TRUE(hashes.insert(hash).second) << "Length " << length;
+        for (auto offset = 1ul; offset < 8ul && length + offset <= BufferSize; offset += 3ul) {
+            std::vector<char> unaligned(length + offset);
+            std::copy_n(Buffer.data(), length, unaligned.data() + offset);
+            ASSERT_EQ(Hash(unaligned.data() + offset, length), hash);
+        }
+    }
+}
+
+TEST(Hash, Avalanche)
+{
+    // Flipping any input bit changes about half of the output bits
+    for (const auto length : { 8ul, 24ul, 120ul, 700ul }) {
+        std::vector<char> data(Buffer.begin(), Buffer.begin() + static_cast<std::ptrdiff_t>(length));
+        const auto reference = Hash(data.data(), data.size());
+        auto flipped = 0ul;
+        for (auto bit = 0ul; bit < length * 8ul; ++bit) {
+            data[bit / 8ul] ^= static_cast<char>(1 << (bit % 8ul));
+            flipped += static_cast<std::size_t>(std::popcount(reference ^ Hash(data.data(), data.size())));
+            data[bit / 8ul] ^= static_cast<char>(1 << (bit % 8ul));
+        }
+        const auto average = static_cast<double>(flipped) / static_cast<double>(length * 8ul);
+        ASSERT_GT(average, 30.0) << "Length " << length;
+        ASSERT_LT(average, 34.0) << "Length " << length;
+    }
+}
+
+TEST(Hash, IdentifierCollisions)
+{
+    constexpr auto BucketBits = 10u;
+    constexpr auto BucketCount = 1ul << BucketBits;
+    const auto identifiers = MakeIdentifiers();
+    std::unordered_set<HashedName> hashes;
+    std::vector<std::size_t> lowBuckets(BucketCount), highBuckets(BucketCount);
+
+    for (const auto &identifier : identifiers) {
+        const auto hash = Hash(identifier);
+        ASSERT_TRUE(hashes.insert(hash).second) << identifier;
+        ++lowBuckets[hash & (BucketCount - 1)];
+        ++highBuckets[hash >> (64u - BucketBits)];
+    }
+    // Both ends of the hash are usable as a bucket index: no bucket is far above the mean load
+    const auto mean = identifiers.size() / BucketCount;
+    ASSERT_LT(*std::max_element(lowBuckets.begin(), lowBuckets.end()), mean * 2);
+    ASSERT_LT(*std::max_element(highBuckets.begin(), highBuckets.end()), mean * 2);
+}
@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 
+#include <Core/AlignedHeapArray.hpp>
 #include <Core/HeapArray.hpp>
 
 
@@ -53,4 +54,49 @@ TEST(HeapArray, Semantics)
         ++i;
     }
     ASSERT_EQ(i, count);
-}
\ No newline at end of file
+}
+
+TEST(AlignedHeapArray, Basics)
+{
+    constexpr auto count = 42ul;
+    Core::AudioBuffer<float, 32> array(count, 1.0f);
+
+    ASSERT_TRUE(array);
+    ASSERT_EQ(array.size(), count);
+    ASSERT_EQ(array.paddedSize(), 48ul);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array.data()) % 32, 0);
+    for (const auto elem : array)
+        ASSERT_EQ(elem, 1.0f);
+    // The padding is zeroed so SIMD loops can read it
+    for (auto i = count; i < array.paddedSize(); ++i)
+        ASSERT_EQ(array[i], 0.0f);
+    array.allocate(count * 2);
+    ASSERT_EQ(array.size(), count * 2);
+    ASSERT_EQ(array.paddedSize(), 88ul);
+    for (auto i = 0ul; i < array.paddedSize(); ++i)
+        ASSERT_EQ(array[i], 0.0f);
+    array.release();
+    ASSERT_FALSE(array);
+    ASSERT_EQ(array.paddedSize(), 0ul);
+}
+
+TEST(AlignedHeapArray, Uninitialized)
+{
+    Core::AlignedHeapArray<double> array(16, 1.0);
+    const auto data = array.data();
+
+    // Reallocating with the same padded size reuses the buffer
+    array.allocateUninitialized(13);
+    ASSERT_EQ(array.data(), data);
+    ASSERT_EQ(array.size(), 13);
+    for (auto i = 0ul; i < array.size(); ++i)
+        ASSERT_EQ(array[i], 1.0);
+    for (auto i = array.size(); i < array.paddedSize(); ++i)
+        ASSERT_EQ(array[i], 0.0);
+    array.allocateUninitialized(1000);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array.data()) % Core::CacheLineSize, 0);
+    ASSERT_EQ(array.paddedSize(), 1000);
+    Core::AlignedHeapArray<double> other(std::move(array));
+    ASSERT_FALSE(array);
+    ASSERT_EQ(other.size(), 1000);
+}
@@ -0,0 +1,73 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the large buffer allocations
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <Core/HeapArray.hpp>
+#include <Core/LargeAlloc.hpp>
+#include <Core/MPMCQueue.hpp>
+#include <Core/SPSCQueue.hpp>
+
+using namespace Core;
+
+TEST(LargeAlloc, Basics)
+{
+    const auto pageSize = Utils::HugePageSize();
+
+    ASSERT_TRUE(pageSize && !(pageSize & (pageSize - 1)));
+    // Small buffers use the aligned heap
+    const auto small = Utils::LargeAlloc(64, 64);
+    ASSERT_NE(small, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(small) % 64, 0);
+    Utils::LargeFree(small, 64, 64);
+    // Large buffers are aligned on huge pages
+    const auto bytes = pageSize * 2 + 42;
+    const auto large = reinterpret_cast<std::byte *>(Utils::LargeAlloc(bytes, alignof(std::max_align_t)));
+    ASSERT_NE(large, nullptr);
+#if defined(__linux__)
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(large) % pageSize, 0);
+#endif
+    std::memset(large, 42, bytes);
+    ASSERT_EQ(large[bytes - 1], std::byte(42));
+    Utils::LargeFree(large, bytes, alignof(std::max_align_t));
+    // Without NUMA binding
+    const auto unbound = Utils::LargeAlloc(bytes, 64, false);
+    ASSERT_NE(unbound, nullptr);
+    Utils::LargeFree(unbound, bytes, 64);
+    Utils::LargeFree(nullptr, bytes, 64);
+}
+
+TEST(LargeAlloc, Containers)
+{
+    constexpr std::size_t Count = 1024 * 1024;
+
+    HeapArray<float, LargeAllocPolicy> array(Count, 1.0f);
+    for (auto i = 0ul; i < Count; ++i)
+        ASSERT_EQ(array[i], 1.0f);
+    array.allocate(16, 2.0f);
+    ASSERT_EQ(array.size(), 16);
+    ASSERT_EQ(array[15], 2.0f);
+    array.allocate(0);
+    ASSERT_TRUE(array.empty());
+    array.release();
+
+    SPSCQueue<std::size_t, NoWaitPolicy, NoQueueStats, LargeAllocPolicy> spsc(Count);
+    MPMCQueue<std::size_t, NoWaitPolicy, NoQueueStats, PackedCellLayout, LargeAllocPolicy> mpmc(Count);
+    for (auto i = 0ul; i < Count; ++i) {
+        ASSERT_TRUE(spsc.push(i));
+        ASSERT_TRUE(mpmc.push(i));
+    }
+    std::size_t value = 0;
+    for (auto i = 0ul; i < Count; ++i) {
+        ASSERT_TRUE(spsc.pop(value));
+        ASSERT_EQ(value, i);
+        ASSERT_TRUE(mpmc.pop(value));
+        ASSERT_EQ(value, i);
+    }
+    spsc.resize(Count * 2);
+    ASSERT_TRUE(spsc.push(42ul));
+}
@@ -4,6 +4,7 @@
  */
 
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -73,4 +74,238 @@ TEST(MPMCQueue, IntensiveThreading)
         if (popThds[i].joinable())
             popThds[i].join();
     }
-}
\ No newline at end of file
+}
+TEST(MPMCQueue, RangePushPop)
+{
+    constexpr std::size_t queueSize = 8;
+
+    Core::MPMCQueue<std::string> queue(queueSize);
+    std::string input[queueSize + 2];
+    std::string output[queueSize + 2];
+
+    for (auto &str : input)
+        str = LongStr;
+    ASSERT_FALSE(queue.tryPushRange(std::begin(input), std::end(input)));
+    ASSERT_EQ(queue.size(), 0);
+    ASSERT_TRUE(queue.tryPushRange(input, input + 5));
+    ASSERT_EQ(queue.pushRange(std::begin(input), std::end(input)), 3);
+    ASSERT_EQ(queue.pushRange(std::begin(input), std::end(input)), 0);
+    ASSERT_FALSE(queue.push(ShortStr));
+    ASSERT_FALSE(queue.tryPopRange(std::begin(output), std::end(output)));
+    ASSERT_TRUE(queue.tryPopRange(output, output + 2));
+    ASSERT_TRUE(queue.push(ShortStr));
+    ASSERT_EQ(queue.popRange(std::begin(output), std::end(output)), 7);
+    for (auto i = 0u; i < 6; ++i)
+        ASSERT_EQ(output[i], LongStr);
+    ASSERT_EQ(output[6], ShortStr);
+    ASSERT_EQ(queue.popRange(std::begin(output), std::end(output)), 0);
+    for (const auto &str : input)
+        ASSERT_EQ(str, LongStr);
+}
+
+TEST(MPMCQueue, RangeIntensiveThreading)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr auto Counter = CORE_DEBUG_BUILD ? 256 : 16384;
+    constexpr auto BatchSize = 16;
+    constexpr std::size_t queueSize = 1024;
+
+    std::atomic<std::size_t> popCount { 0 };
+    std::atomic<std::size_t> popSum { 0 };
+    std::thread pushThds[ThreadCount];
+    std::thread popThds[ThreadCount];
+
+    Core::MPMCQueue<std::size_t> queue(queueSize);
+
+    for (auto i = 0; i < ThreadCount; ++i)
+        pushThds[i] = std::thread([&] {
+            std::size_t batch[BatchSize];
+            for (std::size_t i = 0; i < Counter / ThreadCount;) {
+                const auto count = std::min<std::size_t>(BatchSize, Counter / ThreadCount - i);
+                for (auto j = 0ul; j < count; ++j)
+                    batch[j] = i + j;
+                i += queue.pushRange(batch, batch + count);
+            }
+        });
+    for (auto i = 0; i < ThreadCount; ++i)
+        popThds[i] = std::thread([&] {
+            std::size_t batch[BatchSize];
+            while (popCount != Counter) {
+                const auto count = queue.popRange(std::begin(batch), std::end(batch));
+                for (auto j = 0ul; j < count; ++j)
+                    popSum += batch[j];
+                popCount += count;
+            }
+        });
+    for (auto i = 0; i < ThreadCount; ++i) {
+        pushThds[i].join();
+        popThds[i].join();
+    }
+    constexpr std::size_t PerThread = Counter / ThreadCount;
+    ASSERT_EQ(popCount, Counter);
+    ASSERT_EQ(popSum, ThreadCount * (PerThread * (PerThread - 1) / 2));
+}
+
+TEST(MPMCQueue, BlockingPushPop)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 65536;
+    constexpr std::size_t queueSize = 16;
+
+    Core::MPMCQueue<std::size_t, Core::SpinParkWaitPolicy<64>> queue(queueSize);
+    std::atomic<std::size_t> popSum { 0 };
+    std::thread pushThds[ThreadCount];
+    std::thread popThds[ThreadCount];
+    std::size_t value = 0;
+
+    ASSERT_FALSE(queue.popWaitFor(value, std::chrono::milliseconds(1)));
+    for (auto i = 0; i < ThreadCount; ++i) {
+        pushThds[i] = std::thread([&queue] {
+            for (auto i = 0ul; i < Counter / ThreadCount; ++i)
+                queue.pushWait(i);
+        });
+        popThds[i] = std::thread([&queue, &popSum] {
+            std::size_t value;
+            for (auto i = 0ul; i < Counter / ThreadCount; ++i) {
+                queue.popWait(value);
+                popSum += value;
+            }
+        });
+    }
+    for (auto i = 0; i < ThreadCount; ++i) {
+        pushThds[i].join();
+        popThds[i].join();
+    }
+    constexpr std::size_t PerThread = Counter / ThreadCount;
+    ASSERT_EQ(popSum, ThreadCount * (PerThread * (PerThread - 1) / 2));
+    for (auto i = 0ul; i < queueSize; ++i)
+        ASSERT_TRUE(queue.pushWaitFor(std::chrono::milliseconds(1), i));
+    ASSERT_FALSE(queue.pushWaitFor(std::chrono::milliseconds(1), 42ul));
+}
+
+TEST(MPMCQueue, Stats)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 16384;
+    constexpr std::size_t queueSize = 16;
+
+    Core::MPMCQueue<std::size_t, Core::NoWaitPolicy, Core::QueueStats> queue(queueSize);
+    std::thread pushThds[ThreadCount];
+    std::thread popThds[ThreadCount];
+    std::size_t value = 0;
+
+    ASSERT_FALSE(queue.pop(value));
+    for (auto i = 0ul; i < queueSize; ++i)
+        ASSERT_TRUE(queue.push(i));
+    ASSERT_FALSE(queue.push(42ul));
+    ASSERT_EQ(queue.stats().peakSize, queueSize);
+    queue.clear();
+    queue.resetStats();
+    for (auto i = 0; i < ThreadCount; ++i) {
+        pushThds[i] = std::thread([&queue] {
+            for (auto i = 0ul; i < Counter / ThreadCount; ++i) {
+                while (!queue.push(i))
+                    std::this_thread::yield();
+            }
+        });
+        popThds[i] = std::thread([&queue] {
+            std::size_t value;
+            for (auto i = 0ul; i < Counter / ThreadCount; ++i) {
+                while (!queue.pop(value))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (auto i = 0; i < ThreadCount; ++i) {
+        pushThds[i].join();
+        popThds[i].join();
+    }
+    const auto stats = queue.stats();
+    ASSERT_EQ(stats.pushCount, Counter);
+    ASSERT_EQ(stats.popCount, Counter);
+    ASSERT_LE(stats.peakSize, queueSize);
+    ASSERT_GT(stats.peakSize, 0);
+}
+
+template<typename CellLayout>
+static void TestCellLayout(void)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 16384;
+    constexpr std::size_t queueSize = 64;
+    using Queue = Core::MPMCQueue<std::size_t, Core::NoWaitPolicy, Core::NoQueueStats, CellLayout>;
+
+    Queue queue(queueSize);
+    std::atomic<std::size_t> popSum { 0 };
+    std::thread pushThds[ThreadCount];
+    std::thread popThds[ThreadCount];
+    std::size_t values[queueSize / 2];
+    std::size_t value = 0;
+
+    // Wrap around the buffer several times to check the ordering of positions
+    for (auto i = 0ul; i < queueSize * 3; i += queueSize / 2) {
+        for (auto j = 0ul; j < queueSize / 2; ++j)
+            ASSERT_TRUE(queue.push(i + j));
+        ASSERT_EQ(queue.popRange(std::begin(values), std::end(values)), queueSize / 2);
+        for (auto j = 0ul; j < queueSize / 2; ++j)
+            ASSERT_EQ(values[j], i + j);
+    }
+    for (auto i = 0ul; i < queueSize; ++i)
+        ASSERT_TRUE(queue.push(i));
+    ASSERT_FALSE(queue.push(42ul));
+    for (auto i = 0ul; i < queueSize; ++i) {
+        ASSERT_TRUE(queue.pop(value));
+        ASSERT_EQ(value, i);
+    }
+    for (auto i = 0; i < ThreadCount; ++i) {
+        pushThds[i] = std::thread([&queue] {
+            for (auto i = 0ul; i < Counter / ThreadCount; ++i) {
+                while (!queue.push(i))
+                    std::this_thread::yield();
+            }
+        });
+        popThds[i] = std::thread([&queue, &popSum] {
+            std::size_t value;
+            for (auto i = 0ul; i < Counter / ThreadCount; ++i) {
+                while (!queue.pop(value))
+                    std::this_thread::yield();
+                popSum += value;
+            }
+        });
+    }
+    for (auto i = 0; i < ThreadCount; ++i) {
+        pushThds[i].join();
+        popThds[i].join();
+    }
+    constexpr std::size_t PerThread = Counter / ThreadCount;
+    ASSERT_EQ(popSum, ThreadCount * (PerThread * (PerThread - 1) / 2));
+}
+
+TEST(MPMCQueue, PaddedCellLayout)
+{
+    using Queue = Core::MPMCQueue<std::size_t, Core::NoWaitPolicy, Core::NoQueueStats, Core::PaddedCellLayout>;
+    static_assert(sizeof(Queue::Cell) == Core::CacheLineSize);
+
+    TestCellLayout<Core::PaddedCellLayout>();
+}
+
+TEST(MPMCQueue, ScrambledCellLayout)
+{
+    using Queue = Core::MPMCQueue<std::size_t, Core::NoWaitPolicy, Core::NoQueueStats, Core::ScrambledCellLayout>;
+    constexpr std::size_t mask = 63;
+    std::vector<bool> used(mask + 1, false);
+
+    static_assert(sizeof(Queue::Cell) == 2 * sizeof(std::size_t));
+    // The mapping is a permutation where consecutive positions use different cachelines
+    for (auto i = 0ul; i <= mask; ++i) {
+        const auto index = Core::ScrambledCellLayout::Index<sizeof(Queue::Cell)>(i, mask);
+        ASSERT_LE(index, mask);
+        ASSERT_FALSE(used[index]);
+        used[index] = true;
+        if (i) {
+            ASSERT_NE(index / 4, Core::ScrambledCellLayout::Index<sizeof(Queue::Cell)>(i - 1, mask) / 4);
+        }
+    }
+    ASSERT_THROW(Queue(8), std::logic_error);
+    TestCellLayout<Core::ScrambledCellLayout>();
+}
@@ -0,0 +1,130 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the MPSC Queue
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Core/Assert.hpp>
+#include <Core/MPSCQueue.hpp>
+
+constexpr auto LongStr = "123456789123456789";
+constexpr auto ShortStr = "12345";
+
+TEST(MPSCQueue, SinglePushPop)
+{
+    constexpr std::size_t queueSize = 8;
+
+    Core::MPSCQueue<std::string> queue(queueSize);
+    std::string str;
+
+    ASSERT_FALSE(queue.pop(str));
+    for (auto i = 0u; i < queueSize; ++i)
+        ASSERT_TRUE(queue.push(LongStr));
+    for (auto i = 0u; i < queueSize; ++i)
+        ASSERT_FALSE(queue.push(ShortStr));
+    ASSERT_EQ(queue.size(), queueSize);
+    for (auto i = 0u; i < queueSize; ++i) {
+        ASSERT_TRUE(queue.pop(str));
+        ASSERT_EQ(str, LongStr);
+    }
+    ASSERT_EQ(queue.size(), 0);
+}
+
+TEST(MPSCQueue, RangePushPop)
+{
+    constexpr std::size_t queueSize = 8;
+
+    Core::MPSCQueue<std::string> queue(queueSize);
+    std::string input[queueSize * 2];
+    std::string output[queueSize * 2];
+
+    for (auto i = 0u; i < queueSize * 2; ++i)
+        input[i] = std::to_string(i) + LongStr;
+    ASSERT_FALSE(queue.tryPushRange(std::begin(input), std::end(input)));
+    ASSERT_EQ(queue.pushRange(std::begin(input), std::begin(input) + 5), 5);
+    ASSERT_FALSE(queue.tryPopRange(std::begin(output), std::begin(output) + 6));
+    ASSERT_TRUE(queue.tryPopRange(std::begin(output), std::begin(output) + 3));
+    for (auto i = 0u; i < 3; ++i)
+        ASSERT_EQ(output[i], input[i]);
+    ASSERT_EQ(queue.pushRange(std::begin(input) + 5, std::end(input)), queueSize - 2);
+    ASSERT_EQ(queue.popRange(std::begin(output), std::end(output)), queueSize);
+    for (auto i = 0u; i < queueSize; ++i)
+        ASSERT_EQ(output[i], input[i + 3]);
+    ASSERT_EQ(queue.popRange(std::begin(output), std::end(output)), 0);
+}
+
+TEST(MPSCQueue, IntensiveThreading)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 65536;
+    constexpr std::size_t PerThread = Counter / ThreadCount;
+    constexpr std::size_t BatchSize = 32;
+    constexpr std::size_t queueSize = 256;
+
+    Core::MPSCQueue<std::size_t> queue(queueSize);
+    std::thread pushThds[ThreadCount];
+    std::size_t lastValues[ThreadCount];
+    std::size_t batch[BatchSize];
+
+    for (auto i = 0ul; i < ThreadCount; ++i) {
+        lastValues[i] = 0;
+        pushThds[i] = std::thread([&queue, i] {
+            // Each value encodes its producer and its rank
+            for (auto j = 1ul; j <= PerThread; ++j) {
+                while (!queue.push(j * ThreadCount + i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (auto received = 0ul; received != Counter;) {
+        const auto count = queue.popRange(std::begin(batch), std::end(batch));
+        if (!count)
+            std::this_thread::yield();
+        for (auto i = 0ul; i < count; ++i) {
+            const auto producer = batch[i] % ThreadCount;
+            const auto rank = batch[i] / ThreadCount;
+            // Elements of a single producer are received in order
+            ASSERT_EQ(rank, lastValues[producer] + 1);
+            lastValues[producer] = rank;
+        }
+        received += count;
+    }
+    for (auto i = 0; i < ThreadCount; ++i)
+        pushThds[i].join();
+    for (auto i = 0; i < ThreadCount; ++i)
+        ASSERT_EQ(lastValues[i], PerThread);
+}
+
+TEST(MPSCQueue, BlockingPushPop)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 65536;
+    constexpr std::size_t queueSize = 16;
+
+    Core::MPSCQueue<std::size_t, Core::SpinParkWaitPolicy<64>> queue(queueSize);
+    std::thread pushThds[ThreadCount];
+    std::size_t popSum = 0;
+    std::size_t value = 0;
+
+    ASSERT_FALSE(queue.popWaitFor(value, std::chrono::milliseconds(1)));
+    for (auto i = 0; i < ThreadCount; ++i) {
+        pushThds[i] = std::thread([&queue] {
+            for (auto i = 0ul; i < Counter / ThreadCount; ++i)
+                queue.pushWait(i);
+        });
+    }
+    for (auto i = 0ul; i < Counter; ++i) {
+        queue.popWait(value);
+        popSum += value;
+    }
+    for (auto i = 0; i < ThreadCount; ++i)
+        pushThds[i].join();
+    constexpr std::size_t PerThread = Counter / ThreadCount;
+    ASSERT_EQ(popSum, ThreadCount * (PerThread * (PerThread - 1) / 2));
+    for (auto i = 0ul; i < queueSize; ++i)
+        ASSERT_TRUE(queue.pushWaitFor(std::chrono::milliseconds(1), i));
+    ASSERT_FALSE(queue.pushWaitFor(std::chrono::milliseconds(1), 42ul));
+}
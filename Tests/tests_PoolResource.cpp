@@ -0,0 +1,105 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the pool resource
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Core/Assert.hpp>
+#include <Core/MPMCQueue.hpp>
+#include <Core/PoolResource.hpp>
+#include <Core/UniqueAlloc.hpp>
+
+using namespace Core;
+
+TEST(PoolResource, SizeClasses)
+{
+    static_assert(PoolResource::ClassOf(1, 1) == 0);
+    static_assert(PoolResource::ClassOf(16, 8) == 0);
+    static_assert(PoolResource::ClassOf(17, 8) == 1);
+    static_assert(PoolResource::ClassOf(8, 64) == 2);
+    static_assert(PoolResource::ClassOf(4096, 8) == PoolResource::ClassCount - 1);
+    static_assert(PoolResource::ClassOf(4097, 8) == PoolResource::ClassCount);
+    static_assert(PoolResource::ClassSize(PoolResource::ClassCount - 1) == PoolResource::MaxBlockSize);
+}
+
+TEST(PoolResource, Basics)
+{
+    PoolResource resource;
+
+    ASSERT_EQ(resource.reservedBytes(), 0);
+    const auto first = resource.allocate(24, 8);
+    const auto aligned = resource.allocate(8, 256);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 256, 0);
+    ASSERT_EQ(resource.reservedBytes(), 2 * PoolResource::SlabSize);
+    // Blocks are reused in LIFO order
+    resource.deallocate(first, 24, 8);
+    ASSERT_EQ(resource.allocate(32, 16), first);
+    // Large requests bypass the pool
+    const auto large = resource.allocate(PoolResource::MaxBlockSize * 2, 8);
+    ASSERT_EQ(resource.reservedBytes(), 2 * PoolResource::SlabSize);
+    resource.deallocate(large, PoolResource::MaxBlockSize * 2, 8);
+    resource.deallocate(first, 32, 16);
+    resource.deallocate(aligned, 8, 256);
+    ASSERT_TRUE(resource.is_equal(resource));
+    ASSERT_FALSE(resource.is_equal(*std::pmr::new_delete_resource()));
+}
+
+TEST(PoolResource, UniqueAlloc)
+{
+    using Alloc = UniqueAlloc<std::string, PoolResource>;
+
+    std::vector<Alloc> allocs;
+    for (auto i = 0; i < 1000; ++i)
+        allocs.push_back(Alloc::Make(std::to_string(i)));
+    for (auto i = 0; i < 1000; ++i)
+        ASSERT_EQ(*allocs[static_cast<std::size_t>(i)], std::to_string(i));
+}
+
+TEST(PoolResource, CrossThreadDeallocation)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 65536;
+
+    PoolResource resource;
+    MPMCQueue<std::size_t *> queue(256);
+    std::thread producers[ThreadCount];
+    std::thread consumers[ThreadCount];
+    std::atomic<std::size_t> sum { 0u };
+
+    for (auto i = 0; i < ThreadCount; ++i) {
+        producers[i] = std::thread([&] {
+            for (auto j = 0ul; j < Counter / ThreadCount; ++j) {
+                auto value = new (resource.allocate(sizeof(std::size_t), alignof(std::size_t))) std::size_t(j);
+                while (!queue.push(value))
+                    std::this_thread::yield();
+            }
+        });
+        consumers[i] = std::thread([&] {
+            std::size_t *value = nullptr;
+            for (auto j = 0ul; j < Counter / ThreadCount; ++j) {
+                while (!queue.pop(value))
+                    std::this_thread::yield();
+                sum += *value;
+                resource.deallocate(value, sizeof(std::size_t), alignof(std::size_t));
+            }
+        });
+    }
+    for (auto i = 0; i < ThreadCount; ++i) {
+        producers[i].join();
+        consumers[i].join();
+    }
+    constexpr std::size_t PerThread = Counter / ThreadCount;
+    ASSERT_EQ(sum, ThreadCount * (PerThread * (PerThread - 1) / 2));
+    // Released blocks are recycled instead of allocating new slabs
+    const auto reserved = resource.reservedBytes();
+    std::thread([&resource] {
+        for (auto i = 0ul; i < PoolResource::BatchSize; ++i)
+            ASSERT_NE(resource.allocate(8, 8), nullptr);
+    }).join();
+    ASSERT_EQ(resource.reservedBytes(), reserved);
+}
@@ -84,4 +84,137 @@ TEST(SPSCQueue, IntensiveThreading)
     }
     if (thd.joinable())
         thd.join();
-}
\ No newline at end of file
+}
+TEST(SPSCQueue, BlockingPushPop)
+{
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 65536;
+    constexpr std::size_t queueSize = 16;
+
+    Core::SPSCQueue<std::size_t, Core::SpinParkWaitPolicy<64>> queue(queueSize);
+    std::size_t value = 0;
+
+    ASSERT_FALSE(queue.popWaitFor(value, std::chrono::milliseconds(1)));
+    std::thread producer([&queue] {
+        for (auto i = 0ul; i < Counter; ++i)
+            queue.pushWait(i);
+    });
+    for (auto i = 0ul; i < Counter; ++i) {
+        queue.popWait(value);
+        ASSERT_EQ(value, i);
+    }
+    producer.join();
+    for (auto i = 0ul; i < queueSize; ++i)
+        ASSERT_TRUE(queue.pushWaitFor(std::chrono::milliseconds(1), i));
+    ASSERT_FALSE(queue.pushWaitFor(std::chrono::milliseconds(1), 42ul));
+}
+
+TEST(SPSCQueue, BeginCommit)
+{
+    constexpr std::size_t queueSize = 8;
+
+    Core::SPSCQueue<std::string> queue(queueSize);
+
+    // Move the ring position so that the next claims wrap around
+    for (auto i = 0u; i < 5u; ++i) {
+        std::string str;
+        ASSERT_TRUE(queue.push(ShortStr));
+        ASSERT_TRUE(queue.pop(str));
+    }
+    auto write = queue.beginWrite(queueSize * 2);
+    ASSERT_EQ(write.size(), queueSize);
+    ASSERT_EQ(write.first.size(), 4);
+    ASSERT_EQ(write.second.size(), 4);
+    for (auto i = 0u; i < 6u; ++i)
+        std::construct_at(&write[i], std::to_string(i) + LongStr);
+    queue.commitWrite(6);
+    ASSERT_EQ(queue.size(), 6);
+    ASSERT_EQ(queue.beginWrite(queueSize).size(), 2);
+    auto read = queue.beginRead(4);
+    ASSERT_EQ(read.size(), 4);
+    for (auto i = 0u; i < 4u; ++i)
+        ASSERT_EQ(read[i], std::to_string(i) + LongStr);
+    queue.commitRead(3);
+    read = queue.beginRead(queueSize);
+    ASSERT_EQ(read.size(), 3);
+    ASSERT_EQ(read[0], std::to_string(3) + LongStr);
+    queue.commitRead(read.size());
+    ASSERT_TRUE(queue.beginRead(queueSize).empty());
+    ASSERT_EQ(queue.size(), 0);
+}
+
+TEST(SPSCQueue, BeginCommitThreading)
+{
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 4096 : 1 << 18;
+    constexpr std::size_t queueSize = 1000;
+    constexpr std::size_t BlockSize = 64;
+
+    Core::SPSCQueue<std::size_t> queue(queueSize);
+
+    std::thread producer([&] {
+        for (std::size_t i = 0; i < Counter;) {
+            auto region = queue.beginWrite(std::min(BlockSize, Counter - i));
+            if (region.empty())
+                std::this_thread::yield();
+            for (auto j = 0ul; j < region.size(); ++j)
+                region[j] = i + j;
+            queue.commitWrite(region.size());
+            i += region.size();
+        }
+    });
+    for (std::size_t i = 0; i < Counter;) {
+        const auto region = queue.beginRead(BlockSize);
+        if (region.empty())
+            std::this_thread::yield();
+        for (auto j = 0ul; j < region.size(); ++j)
+            ASSERT_EQ(region[j], i + j);
+        queue.commitRead(region.size());
+        i += region.size();
+    }
+    producer.join();
+}
+
+TEST(SPSCQueue, Stats)
+{
+    constexpr std::size_t queueSize = 4;
+
+    Core::SPSCQueue<std::size_t, Core::NoWaitPolicy, Core::QueueStats> queue(queueSize);
+    std::size_t values[queueSize] { 1, 2, 3, 4 };
+    std::size_t value = 0;
+
+    ASSERT_FALSE(queue.pop(value));
+    ASSERT_TRUE(queue.push(0ul));
+    ASSERT_EQ(queue.pushRange(std::begin(values), std::end(values)), queueSize - 1);
+    ASSERT_FALSE(queue.push(42ul));
+    ASSERT_EQ(queue.popRange(std::begin(values), std::end(values)), queueSize);
+    auto stats = queue.stats();
+    ASSERT_EQ(stats.pushCount, queueSize);
+    ASSERT_EQ(stats.popCount, queueSize);
+    ASSERT_EQ(stats.pushFailures, 1);
+    ASSERT_EQ(stats.popFailures, 1);
+    ASSERT_EQ(stats.pushRetries, 0);
+    ASSERT_EQ(stats.popRetries, 0);
+    ASSERT_EQ(stats.peakSize, queueSize);
+    queue.resetStats();
+    stats = queue.stats();
+    ASSERT_EQ(stats.pushCount, 0);
+    ASSERT_EQ(stats.peakSize, 0);
+    ASSERT_EQ(Core::SPSCQueue<int>(queueSize).stats().pushCount, 0);
+}
+
+TEST(SPSCQueue, EmptyRangeStats)
+{
+    Core::SPSCQueue<std::size_t, Core::NoWaitPolicy, Core::QueueStats> queue(4);
+    std::size_t values[1] { 0 };
+
+    // Empty ranges are neither operations nor failures
+    ASSERT_EQ(queue.pushRange(std::begin(values), std::begin(values)), 0);
+    ASSERT_EQ(queue.popRange(std::begin(values), std::begin(values)), 0);
+    ASSERT_FALSE(queue.tryPushRange(std::begin(values), std::begin(values)));
+    ASSERT_FALSE(queue.tryPopRange(std::begin(values), std::begin(values)));
+    const auto stats = queue.stats();
+    ASSERT_EQ(stats.pushCount, 0);
+    ASSERT_EQ(stats.popCount, 0);
+    ASSERT_EQ(stats.pushFailures, 0);
+    ASSERT_EQ(stats.popFailures, 0);
+    ASSERT_EQ(stats.peakSize, 0);
+}
@@ -0,0 +1,69 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the unbounded SPSC Queue
+ */
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Core/Assert.hpp>
+#include <Core/SPSCUnboundedQueue.hpp>
+
+TEST(SPSCUnboundedQueue, SinglePushPop)
+{
+    constexpr std::size_t Count = 100;
+
+    Core::SPSCUnboundedQueue<std::string, 8> queue;
+    std::string str;
+
+    ASSERT_FALSE(queue.pop(str));
+    for (auto i = 0u; i < Count; ++i)
+        queue.push(std::to_string(i) + "123456789123456789");
+    ASSERT_EQ(queue.size(), Count);
+    for (auto i = 0u; i < Count; ++i) {
+        ASSERT_TRUE(queue.pop(str));
+        ASSERT_EQ(str, std::to_string(i) + "123456789123456789");
+    }
+    ASSERT_FALSE(queue.pop(str));
+    ASSERT_EQ(queue.size(), 0);
+}
+
+TEST(SPSCUnboundedQueue, Recycling)
+{
+    Core::SPSCUnboundedQueue<std::size_t, 4> queue;
+    std::size_t value = 0;
+
+    for (auto i = 0ul; i < 1000; ++i) {
+        queue.push(i);
+        queue.push(i);
+        queue.push(i);
+        for (auto j = 0; j < 3; ++j) {
+            ASSERT_TRUE(queue.pop(value));
+            ASSERT_EQ(value, i);
+        }
+    }
+    for (auto i = 0ul; i < 50; ++i)
+        queue.push(i);
+}
+
+TEST(SPSCUnboundedQueue, IntensiveThreading)
+{
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 4096 : 1 << 20;
+
+    Core::SPSCUnboundedQueue<std::size_t, 64> queue;
+
+    std::thread producer([&queue] {
+        for (auto i = 0ul; i < Counter; ++i)
+            queue.push(i);
+    });
+    for (auto i = 0ul; i < Counter;) {
+        std::size_t value;
+        if (queue.pop(value)) {
+            ASSERT_EQ(value, i);
+            ++i;
+        }
+    }
+    producer.join();
+}
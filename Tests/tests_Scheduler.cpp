@@ -0,0 +1,138 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the work-stealing scheduler
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Core/Assert.hpp>
+#include <Core/Scheduler.hpp>
+
+namespace
+{
+    /** @brief Recursive fibonacci, each call spawns its children */
+    void Fibonacci(Core::Scheduler &scheduler, const std::size_t n, std::atomic<std::size_t> &result)
+    {
+        if (n < 2) {
+            result += n;
+            return;
+        }
+        const auto parent = Core::Scheduler::CurrentTask();
+        scheduler.dispatch([&scheduler, n, &result] { Fibonacci(scheduler, n - 1, result); }, parent);
+        scheduler.dispatch([&scheduler, n, &result] { Fibonacci(scheduler, n - 2, result); }, parent);
+    }
+}
+
+TEST(Scheduler, Dispatch)
+{
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 1024 : 65536;
+
+    Core::Scheduler scheduler(4, 1024);
+    std::atomic<std::size_t> sum { 0 };
+
+    ASSERT_EQ(scheduler.workerCount(), 4);
+    const auto root = scheduler.create([] {});
+    for (auto i = 1ul; i <= Counter; ++i)
+        scheduler.dispatch([&sum, i] { sum += i; }, root);
+    scheduler.submit(root);
+    scheduler.wait(root);
+    ASSERT_EQ(sum, Counter * (Counter + 1) / 2);
+}
+
+TEST(Scheduler, TaskGraph)
+{
+    constexpr std::size_t N = CORE_DEBUG_BUILD ? 12 : 20;
+    constexpr std::size_t Expected = CORE_DEBUG_BUILD ? 144 : 6765;
+
+    Core::Scheduler scheduler(4, 256);
+    std::atomic<std::size_t> result { 0 };
+
+    const auto root = scheduler.create([&scheduler, &result] { Fibonacci(scheduler, N, result); });
+    ASSERT_EQ(Core::Scheduler::CurrentTask(), nullptr);
+    scheduler.submit(root);
+    scheduler.wait(root);
+    ASSERT_EQ(result, Expected);
+}
+
+TEST(Scheduler, NestedWait)
+{
+    Core::Scheduler scheduler(2, 64);
+    std::atomic<std::size_t> count { 0 };
+
+    const auto root = scheduler.create([&scheduler, &count] {
+        for (auto i = 0; i < 16; ++i) {
+            const auto child = scheduler.create([&count] { ++count; });
+            scheduler.submit(child);
+            scheduler.wait(child);
+        }
+    });
+    scheduler.submit(root);
+    scheduler.wait(root);
+    ASSERT_EQ(count, 16);
+}
+
+TEST(Scheduler, Destruction)
+{
+    std::atomic<std::size_t> count { 0 };
+
+    {
+        Core::Scheduler scheduler(2, 64);
+        for (auto i = 0; i < 256; ++i)
+            scheduler.dispatch([&count] { ++count; });
+    }
+    ASSERT_EQ(count, 256);
+}
+
+TEST(Scheduler, DequeOverflow)
+{
+    constexpr std::size_t QueueCapacity = 4;
+    constexpr std::size_t Count = QueueCapacity * 4;
+
+    Core::Scheduler scheduler(1, QueueCapacity);
+    std::atomic<std::size_t> count { 0 };
+
+    // The worker overflows both its deque and the injection queue
+    const auto root = scheduler.create([&scheduler, &count] {
+        const auto parent = Core::Scheduler::CurrentTask();
+        for (auto i = 0ul; i < Count; ++i)
+            scheduler.dispatch([&count] { ++count; }, parent);
+    });
+    scheduler.submit(root);
+    scheduler.wait(root);
+    ASSERT_EQ(count, Count);
+}
+
+TEST(Scheduler, ConcurrentDispatch)
+{
+    constexpr std::size_t Rounds = 100;
+    constexpr std::size_t ThreadCount = 4;
+
+    Core::Scheduler scheduler(2, 64);
+    std::atomic<std::size_t> count { 0 };
+
+    // Tasks are never waited on, a worker must be woken for each concurrent dispatch
+    for (auto round = 1ul; round <= Rounds; ++round) {
+        // Let the workers park
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::atomic<std::size_t> ready { 0 };
+        std::vector<std::thread> threads;
+        for (auto i = 0ul; i < ThreadCount; ++i) {
+            threads.emplace_back([&scheduler, &count, &ready] {
+                // Start all dispatches at once
+                ready.fetch_add(1);
+                while (ready.load() != ThreadCount);
+                scheduler.dispatch([&count] { ++count; });
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (count != round * ThreadCount && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        ASSERT_EQ(count, round * ThreadCount);
+    }
+}
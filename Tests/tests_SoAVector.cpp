@@ -0,0 +1,130 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the structure of arrays vector
+ */
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Core/SoAVector.hpp>
+
+#include "TestsUtils.hpp"
+
+using namespace Core;
+
+using Tests::Counted;
+
+namespace
+{
+    /** @brief Field whose copy throws once armed */
+    struct ThrowingCopy
+    {
+        static inline bool Armed = false;
+
+        ThrowingCopy(void) noexcept = default;
+        ThrowingCopy(const ThrowingCopy &) { if (Armed) throw std::runtime_error("ThrowingCopy"); }
+        ThrowingCopy &operator=(const ThrowingCopy &) noexcept = default;
+    };
+}
+
+TEST(SoAVector, Basics)
+{
+    SoAVector<float, std::uint8_t, double> vector;
+
+    ASSERT_FALSE(vector);
+    ASSERT_EQ(vector.size(), 0);
+    ASSERT_EQ(vector.capacity(), 0);
+    for (auto i = 0; i < 100; ++i) {
+        const auto [gain, note, phase] = vector.push(static_cast<float>(i), static_cast<std::uint8_t>(i), i * 2.0);
+        ASSERT_EQ(gain, static_cast<float>(i));
+        ASSERT_EQ(note, i);
+        ASSERT_EQ(phase, i * 2.0);
+    }
+    ASSERT_EQ(vector.size(), 100);
+    ASSERT_GE(vector.capacity(), 100);
+    // Each field lives in its own cacheline aligned array
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vector.data<0>()) % CacheLineSize, 0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vector.data<1>()) % CacheLineSize, 0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vector.data<2>()) % CacheLineSize, 0);
+    std::get<2>(vector[10]) = 42.0;
+    ASSERT_EQ(vector.get<2>()[10], 42.0);
+    for (auto &gain : vector.get<0>())
+        gain *= 2.0f;
+    ASSERT_EQ(std::accumulate(vector.get<0>().begin(), vector.get<0>().end(), 0.0f), 99.0f * 100.0f);
+    vector.erase(0);
+    ASSERT_EQ(vector.size(), 99);
+    ASSERT_EQ(std::get<1>(vector.front()), 1);
+    ASSERT_EQ(std::get<1>(vector.back()), 99);
+    vector.pop();
+    ASSERT_EQ(std::get<1>(vector.back()), 98);
+    vector.clear();
+    ASSERT_TRUE(vector.empty());
+    ASSERT_NE(vector.capacity(), 0);
+    vector.release();
+    ASSERT_EQ(vector.capacity(), 0);
+}
+
+TEST(SoAVector, Semantics)
+{
+    {
+        TinySoAVector<std::string, Counted> vector;
+        for (auto i = 0; i < 50; ++i)
+            vector.push("String long enough to allocate " + std::to_string(i), i);
+        ASSERT_EQ(Counted::Alive, 50);
+        auto copy(vector);
+        ASSERT_EQ(Counted::Alive, 100);
+        ASSERT_EQ(std::get<0>(copy[20]), std::get<0>(vector[20]));
+        auto moved(std::move(copy));
+        ASSERT_TRUE(copy.empty());
+        ASSERT_EQ(moved.size(), 50);
+        copy = moved;
+        ASSERT_EQ(Counted::Alive, 150);
+        moved = std::move(vector);
+        ASSERT_EQ(Counted::Alive, 100);
+        copy.erase(10);
+        ASSERT_EQ(std::get<1>(copy[10]).value, 11);
+        ASSERT_EQ(Counted::Alive, 99);
+        copy.resize(60);
+        ASSERT_EQ(Counted::Alive, 110);
+        ASSERT_TRUE(std::get<0>(copy.back()).empty());
+        copy.resize(5);
+        ASSERT_EQ(Counted::Alive, 55);
+    }
+    ASSERT_EQ(Counted::Alive, 0);
+}
+
+TEST(SoAVector, CopyThrow)
+{
+    using Vector = SoAVector<Counted, ThrowingCopy>;
+
+    Vector vector;
+    for (auto i = 0; i < 20; ++i)
+        vector.push(i, ThrowingCopy());
+    ThrowingCopy::Armed = true;
+    ASSERT_THROW(Vector copy(vector), std::runtime_error);
+    ThrowingCopy::Armed = false;
+    // The fields copied before the throw are destroyed
+    ASSERT_EQ(Counted::Alive, 20);
+}
+
+TEST(SoAVector, Reserve)
+{
+    SoAVector<int, float> vector;
+
+    ASSERT_TRUE(vector.reserve(10));
+    ASSERT_EQ(vector.capacity(), 10);
+    ASSERT_FALSE(vector.reserve(5));
+    for (auto i = 0; i < 10; ++i)
+        vector.push(i, static_cast<float>(i));
+    ASSERT_EQ(vector.capacity(), 10);
+    vector.push(10, 10.0f);
+    ASSERT_EQ(vector.capacity(), 20);
+    for (auto i = 0; i < 11; ++i) {
+        const auto [integer, real] = vector[static_cast<std::size_t>(i)];
+        ASSERT_EQ(integer, i);
+        ASSERT_EQ(real, static_cast<float>(i));
+    }
+}
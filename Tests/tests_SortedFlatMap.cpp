@@ -0,0 +1,178 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the sorted flat maps
+ */
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Core/SortedFlatMap.hpp>
+#include <Core/SortedFlatVectorMap.hpp>
+#include <Core/SortedSmallFlatMap.hpp>
+#include <Core/String.hpp>
+
+namespace
+{
+    /** @brief Value whose construction throws on negative inputs */
+    struct ThrowingValue
+    {
+        int value { 0 };
+
+        ThrowingValue(void) noexcept = default;
+        ThrowingValue(const int input) : value(input) { if (input < 0) throw std::invalid_argument("ThrowingValue"); }
+    };
+}
+
+#define PassVargs(...) __VA_OPT__(,) __VA_ARGS__
+
+#define GENERATE_SORTED_FLAT_MAP_TESTS(Map, ...) \
+TEST(Map, Basics) \
+{ \
+    Map<int, int PassVargs(__VA_ARGS__)> map; \
+ \
+    ASSERT_TRUE(map.empty()); \
+    ASSERT_EQ(map.find(42), map.end()); \
+    ASSERT_EQ(map.begin(), map.end()); \
+    ASSERT_FALSE(map.erase(42)); \
+    for (auto i = 99; i >= 0; --i) \
+        ASSERT_TRUE(map.tryEmplace(i * 2, i).second); \
+    ASSERT_FALSE(map.tryEmplace(10, 0).second); \
+    ASSERT_EQ(map.size(), 100); \
+    ASSERT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end())); \
+    for (auto i = 0; i < 200; ++i) { \
+        ASSERT_EQ(map.contains(i), !(i % 2)); \
+        if (!(i % 2)) { \
+            const auto it = map.find(i); \
+            ASSERT_EQ(it->first, i); \
+            ASSERT_EQ(it->second, i / 2); \
+        } \
+    } \
+    ASSERT_EQ(map.lowerBound(11)->first, 12); \
+    ASSERT_EQ(map.at(10), 5); \
+    map[10] = 42; \
+    ASSERT_EQ(map[10], 42); \
+    ASSERT_EQ(map[1], 0); \
+    ASSERT_FALSE(map.insertOrAssign(1, 1).second); \
+    ASSERT_EQ(map.at(1), 1); \
+    ASSERT_TRUE(map.insert(std::make_pair(1000, 3)).second); \
+    ASSERT_EQ(map.keys().size(), map.values().size()); \
+    auto previous = -1; \
+    for (const auto [key, value] : map) { \
+        ASSERT_LT(previous, key); \
+        ASSERT_EQ(map.at(key), value); \
+        previous = key; \
+    } \
+    ASSERT_TRUE(map.erase(1000)); \
+    ASSERT_EQ(map.erase(map.find(0))->first, 1); \
+    ASSERT_FALSE(map.contains(0)); \
+    ASSERT_EQ(map.size(), 100); \
+    map.clear(); \
+    ASSERT_TRUE(map.empty()); \
+    map.release(); \
+    ASSERT_EQ(map.capacity(), 0); \
+} \
+ \
+TEST(Map, HeterogeneousLookup) \
+{ \
+    Map<Core::String, int PassVargs(__VA_ARGS__)> map { { "Oscillator", 1 }, { "Filter", 2 } }; \
+ \
+    map.tryEmplace(std::string_view("Envelope"), 3); \
+    map["Delay"] = 4; \
+    ASSERT_EQ(map.size(), 4); \
+    ASSERT_EQ(map.begin()->first, "Delay"); \
+    ASSERT_EQ(map.at(std::string_view("Oscillator")), 1); \
+    ASSERT_EQ(map.at("Filter"), 2); \
+    ASSERT_EQ(map.at(Core::String("Envelope")), 3); \
+    ASSERT_EQ(map.at(std::string("Delay")), 4); \
+    ASSERT_FALSE(map.contains(std::string_view("Osc"))); \
+    ASSERT_TRUE(map.erase(std::string_view("Filter"))); \
+    ASSERT_FALSE(map.contains("Filter")); \
+} \
+ \
+TEST(Map, Semantics) \
+{ \
+    Map<std::string, std::string PassVargs(__VA_ARGS__)> map; \
+ \
+    for (auto i = 0; i < 20; ++i) \
+        map.tryEmplace(std::to_string(i), "Value long enough to allocate " + std::to_string(i)); \
+    auto copy(map); \
+    ASSERT_EQ(copy, map); \
+    auto moved(std::move(copy)); \
+    ASSERT_EQ(moved, map); \
+    copy = moved; \
+    ASSERT_EQ(copy, map); \
+    copy.at("3") = "Modified"; \
+    ASSERT_NE(copy, map); \
+    map = std::move(copy); \
+    ASSERT_EQ(map.at("3"), "Modified"); \
+} \
+ \
+TEST(Map, ExceptionSafety) \
+{ \
+    Map<int, ThrowingValue PassVargs(__VA_ARGS__)> map; \
+ \
+    for (auto i = 0; i < 20; ++i) \
+        map.tryEmplace(i * 2, i); \
+    /* gtest exception assertions can't be expanded twice on the same line */ \
+    const auto throws = [&map](const int key) { \
+        try { \
+            map.tryEmplace(key, -1); \
+        } catch (const std::invalid_argument &) { \
+            return true; \
+        } \
+        return false; \
+    }; \
+    ASSERT_TRUE(throws(-1)); \
+    ASSERT_TRUE(throws(7)); \
+    ASSERT_TRUE(throws(100)); \
+    ASSERT_EQ(map.size(), 20); \
+    ASSERT_EQ(map.keys().size(), map.values().size()); \
+    ASSERT_FALSE(map.contains(7)); \
+    for (auto i = 0; i < 20; ++i) \
+        ASSERT_EQ(map.at(i * 2).value, i); \
+} \
+ \
+TEST(Map, Random) \
+{ \
+    std::mt19937 engine(42); \
+    std::uniform_int_distribution<int> keys(0, 512), actions(0, 3); \
+    Map<int, int PassVargs(__VA_ARGS__)> map; \
+    std::map<int, int> reference; \
+ \
+    for (auto i = 0; i < 20000; ++i) { \
+        const auto key = keys(engine); \
+        switch (actions(engine)) { \
+        case 0: \
+            ASSERT_EQ(map.erase(key), reference.erase(key) == 1); \
+            break; \
+        case 1: \
+            ASSERT_EQ(map.tryEmplace(key, i).second, reference.try_emplace(key, i).second); \
+            break; \
+        case 2: \
+            map.insertOrAssign(key, i); \
+            reference.insert_or_assign(key, i); \
+            break; \
+        default: \
+            ASSERT_EQ(map.contains(key), reference.contains(key)); \
+            break; \
+        } \
+        ASSERT_EQ(map.size(), reference.size()); \
+    } \
+    auto it = map.begin(); \
+    for (const auto &[key, value] : reference) { \
+        ASSERT_EQ(it->first, key); \
+        ASSERT_EQ(it->second, value); \
+        ++it; \
+    } \
+}
+
+using namespace Core;
+
+GENERATE_SORTED_FLAT_MAP_TESTS(SortedFlatMap)
+GENERATE_SORTED_FLAT_MAP_TESTS(SortedFlatVectorMap)
+GENERATE_SORTED_FLAT_MAP_TESTS(SortedSmallFlatMap, 8)
@@ -5,11 +5,63 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
 #include <string>
 
 #include <Core/SortedVector.hpp>
 #include <Core/SortedFlatVector.hpp>
 #include <Core/SortedSmallVector.hpp>
+#include <Core/SortedAllocatedVector.hpp>
+#include <Core/SortedAllocatedFlatVector.hpp>
+
+namespace
+{
+    /** @brief Element ordered by its key only, the payload tells equivalent elements apart */
+    struct KeyedEntry
+    {
+        std::size_t key;
+        std::size_t payload;
+
+        [[nodiscard]] bool operator<(const KeyedEntry &other) const noexcept { return key < other.key; }
+        [[nodiscard]] bool operator==(const KeyedEntry &other) const noexcept { return key == other.key && payload == other.payload; }
+    };
+
+    /** @brief Allocator counting its allocations */
+    struct CountingAllocator
+    {
+        static inline std::size_t Allocations = 0;
+        static inline std::size_t Live = 0;
+
+        static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+            { ++Allocations; ++Live; return Core::Utils::AlignedAlloc(bytes, alignment); }
+
+        static void Deallocate(void * const data, const std::size_t, const std::size_t) noexcept
+            { --Live; Core::Utils::AlignedFree(data); }
+    };
+
+    /** @brief Check that merging an inserted batch only allocates through the allocator of the vector */
+    template<typename Vector>
+    void TestAllocatedInsertBatch(void)
+    {
+        Vector vector;
+        std::vector<std::size_t> batch;
+
+        vector.reserve(96);
+        for (auto i = 0ul; i < 64ul; ++i)
+            vector.push(i * 2);
+        for (auto i = 0ul; i < 16ul; ++i)
+            batch.push_back(i * 7 + 1);
+        const auto allocations = CountingAllocator::Allocations;
+        vector.insert(batch.begin(), batch.end());
+        ASSERT_EQ(CountingAllocator::Allocations, allocations + 1);
+        ASSERT_EQ(CountingAllocator::Live, 1);
+        ASSERT_EQ(vector.size(), 80);
+        ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end()));
+        vector.release();
+        ASSERT_EQ(CountingAllocator::Live, 0);
+    }
+}
 
 #define PassVargs(...) __VA_OPT__(,) __VA_ARGS__
 
@@ -168,6 +220,94 @@ TEST(Vector, NullArgs) \
     ASSERT_EQ(f.size(), 0ul); ASSERT_TRUE(f.empty()); \
     ASSERT_EQ(g.size(), 0ul); ASSERT_TRUE(g.empty()); \
     ASSERT_EQ(h.size(), 0ul); ASSERT_TRUE(h.empty()); \
+} \
+ \
+TEST(Vector, Search) \
+{ \
+    Vector<std::size_t PassVargs(__VA_ARGS__)> vector; \
+    ASSERT_EQ(vector.lowerBound(42u), vector.end()); \
+    ASSERT_EQ(vector.find(42u), vector.end()); \
+    ASSERT_FALSE(vector.contains(42u)); \
+    for (auto count = 1ul; count < 70ul; ++count) { \
+        vector.clear(); \
+        /* Even values only, each one twice */ \
+        for (auto i = 0ul; i < count; ++i) { \
+            vector.push(i * 2); \
+            vector.push(i * 2); \
+        } \
+        for (auto value = 0ul; value <= count * 2; ++value) { \
+            const auto lower = std::lower_bound(vector.begin(), vector.end(), value); \
+            const auto upper = std::upper_bound(vector.begin(), vector.end(), value); \
+            ASSERT_EQ(vector.lowerBound(value), lower); \
+            ASSERT_EQ(vector.upperBound(value), upper); \
+            ASSERT_EQ(vector.contains(value), !(value % 2) && value < count * 2); \
+            ASSERT_EQ(vector.find(value), vector.contains(value) ? lower : vector.end()); \
+        } \
+    } \
+    ASSERT_EQ(vector.find([](const std::size_t x) { return x == 4; }), vector.begin() + 4); \
+} \
+ \
+TEST(Vector, PushAliased) \
+{ \
+    Vector<std::string PassVargs(__VA_ARGS__)> vector; \
+ \
+    for (auto i = 0; i < 20; ++i) \
+        vector.push(std::to_string(i % 10) + " is a string long enough to allocate"); \
+    /* Pushing an element of the vector must not read it after the gap opening */ \
+    for (auto i = 0; i < 20; ++i) { \
+        const auto expected = vector[static_cast<std::size_t>(i)]; \
+        ASSERT_EQ(vector.push(vector[static_cast<std::size_t>(i)]), expected); \
+        ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    } \
+    ASSERT_EQ(vector.size(), 40); \
+} \
+ \
+TEST(Vector, Assign) \
+{ \
+    Vector<KeyedEntry PassVargs(__VA_ARGS__)> vector; \
+    std::vector<KeyedEntry> reference; \
+    std::size_t seed = 24; \
+ \
+    for (auto i = 0ul; i < 30ul; ++i) { \
+        vector.push(KeyedEntry { i / 2, i }); \
+        reference.push_back(KeyedEntry { i / 2, i }); \
+    } \
+    for (auto i = 0ul; i < 500ul; ++i) { \
+        seed = seed * 6364136223846793005ul + 1442695040888963407ul; \
+        const auto index = (seed >> 33) % reference.size(); \
+        const KeyedEntry value { (seed >> 13) % 20ul, 100ul + i }; \
+        const auto it = reference.begin() + static_cast<std::ptrdiff_t>(index); \
+        const auto pos = vector.assign(index, value); \
+        /* An element only moves past strictly ordered neighbours, then lands after its equivalents like a push */ \
+        if ((index && value < it[-1]) || (index + 1 < reference.size() && it[1] < value)) { \
+            reference.erase(it); \
+            reference.insert(std::upper_bound(reference.begin(), reference.end(), value), value); \
+        } else \
+            *it = value; \
+        ASSERT_EQ(vector[pos], value); \
+        ASSERT_TRUE(std::equal(vector.begin(), vector.end(), reference.begin(), reference.end())); \
+    } \
+} \
+ \
+TEST(Vector, InsertBatch) \
+{ \
+    Vector<std::size_t PassVargs(__VA_ARGS__)> vector; \
+    std::vector<std::size_t> reference; \
+    std::size_t seed = 42; \
+ \
+    for (auto batch = 0ul; batch < 50ul; ++batch) { \
+        std::vector<std::size_t> values(batch % 7 * 5); \
+        for (auto &value : values) { \
+            seed = seed * 6364136223846793005ul + 1442695040888963407ul; \
+            /* Every third batch is appended after the existing values */ \
+            value = (batch % 3 ? 0ul : 1000ul * batch) + (seed >> 33) % 1000ul; \
+        } \
+        vector.insert(values.begin(), values.end()); \
+        reference.insert(reference.end(), values.begin(), values.end()); \
+        std::sort(reference.begin(), reference.end()); \
+        ASSERT_EQ(vector.size(), reference.size()); \
+        ASSERT_TRUE(std::equal(vector.begin(), vector.end(), reference.begin(), reference.end())); \
+    } \
 }
 
 using namespace Core;
@@ -175,3 +315,9 @@ using namespace Core;
 GENERATE_VECTOR_TESTS(SortedVector)
 GENERATE_VECTOR_TESTS(SortedFlatVector)
 GENERATE_VECTOR_TESTS(SortedSmallVector, 4)
+
+TEST(SortedAllocatedVector, InsertBatch)
+{
+    TestAllocatedInsertBatch<SortedAllocatedVector<std::size_t, &CountingAllocator::Allocate, &CountingAllocator::Deallocate>>();
+    TestAllocatedInsertBatch<SortedAllocatedFlatVector<std::size_t, &CountingAllocator::Allocate, &CountingAllocator::Deallocate>>();
+}
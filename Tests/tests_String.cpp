@@ -5,6 +5,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <Core/PMR.hpp>
 #include <Core/String.hpp>
 #include <Core/AllocatedString.hpp>
@@ -48,6 +50,36 @@ TEST(String, Basics) \
     str = std::string(value); \
     assertStringValue(str); \
     str = std::string_view(value); \
+} \
+ \
+TEST(String, Search) \
+{ \
+    String##Class str("Plugin/Parameter/Gain"); \
+ \
+    ASSERT_EQ(str.find('/') - str.begin(), 6); \
+    ASSERT_EQ(str.find('?'), str.end()); \
+    ASSERT_EQ(str.find("Parameter") - str.begin(), 7); \
+    ASSERT_EQ(str.find("Gain") - str.begin(), 17); \
+    ASSERT_EQ(str.find("Gains"), str.end()); \
+    ASSERT_EQ(str.find(""), str.begin()); \
+    ASSERT_EQ(str.find([](const char c) { return c >= 'A' && c <= 'Z' && c != 'P'; }) - str.begin(), 17); \
+    ASSERT_EQ(std::as_const(str).find([](const char c) { return c == 'a'; }) - str.begin(), 8); \
+    ASSERT_EQ(str.find([](const char c) { return c == '?'; }), str.end()); \
+    ASSERT_TRUE(str.startsWith("Plugin/")); \
+    ASSERT_FALSE(str.startsWith("plugin/")); \
+    ASSERT_TRUE(str.endsWith("/Gain")); \
+    ASSERT_FALSE(str.endsWith("Plugin/Parameter/Gain/")); \
+    ASSERT_TRUE(str.equalsCaseInsensitive("plugin/PARAMETER/gain")); \
+    ASSERT_FALSE(str.equalsCaseInsensitive("plugin/PARAMETER/gaim")); \
+    ASSERT_FALSE(str.equalsCaseInsensitive("plugin")); \
+ \
+    String##Class empty; \
+    ASSERT_EQ(empty.find('a'), empty.end()); \
+    ASSERT_EQ(empty.find("a"), empty.end()); \
+    ASSERT_TRUE(empty.startsWith("")); \
+    ASSERT_TRUE(empty.endsWith("")); \
+    ASSERT_FALSE(empty.endsWith("a")); \
+    ASSERT_TRUE(empty.equalsCaseInsensitive("")); \
 }
 
 using namespace Core;
@@ -70,3 +102,50 @@ GENERATE_STRING_TESTS(FlatStringBase)
 GENERATE_STRING_TESTS(AllocatedFlatStringBase, &DefaultAlloc, &DefaultDealloc)
 GENERATE_STRING_TESTS(SmallStringBase, 4ul)
 GENERATE_STRING_TESTS(AllocatedSmallStringBase, 4ul, &DefaultAlloc, &DefaultDealloc)
+
+TEST(String, VectorizedAlgorithms)
+{
+    constexpr Utils::StringKernels Dispatch {
+        "Dispatch", &Utils::StringEqual, &Utils::StringEqualCaseInsensitive, &Utils::StringFind, &Utils::StringFind
+    };
+
+    // Cover every block size, tail and alignment of each kernel the CPU supports against std::string_view
+    std::string buffer;
+    for (auto i = 0u; i < 200u; ++i)
+        buffer.push_back(static_cast<char>('A' + i % 7));
+    auto kernels = std::vector<Utils::StringKernels>(Utils::SupportedStringKernels().begin(), Utils::SupportedStringKernels().end());
+    kernels.push_back(Dispatch);
+    ASSERT_STREQ(kernels.front().name, "Scalar");
+    for (const auto &kernel : kernels) {
+        SCOPED_TRACE(kernel.name);
+        for (auto offset = 0ul; offset < 3ul; ++offset) {
+            for (auto size = 0ul; size + offset <= buffer.size(); ++size) {
+                const std::string_view view(buffer.data() + offset, size);
+                std::string copy(view);
+                ASSERT_TRUE(kernel.equal(view.data(), copy.data(), size));
+                std::string lower(copy);
+                for (auto &c : lower)
+                    c = static_cast<char>(c - 'A' + 'a');
+                ASSERT_TRUE(kernel.equalCaseInsensitive(view.data(), lower.data(), size));
+                if (size) {
+                    copy[size - 1] = '!';
+                    ASSERT_FALSE(kernel.equal(view.data(), copy.data(), size));
+                    lower[size / 2] = '!';
+                    ASSERT_FALSE(kernel.equalCaseInsensitive(view.data(), lower.data(), size));
+                }
+                for (const auto c : { 'A', 'D', 'G', 'Z' }) {
+                    const auto expected = view.find(c);
+                    const auto found = kernel.findChar(view.data(), size, c);
+                    ASSERT_EQ(found ? static_cast<std::size_t>(found - view.data()) : std::string_view::npos, expected);
+                }
+                for (const std::string_view needle : { "", "B", "CD", "GAB", "EFGABCDE", "ABCDEFGABCDEFGABCDEFGABCDEFGABCDEFGA", "AC" }) {
+                    const auto expected = view.find(needle);
+                    const auto found = kernel.findString(view.data(), size, needle.data(), needle.size());
+                    ASSERT_EQ(found ? static_cast<std::size_t>(found - view.data()) : std::string_view::npos, expected);
+                }
+            }
+        }
+        // Only letters are folded
+        ASSERT_FALSE(kernel.equalCaseInsensitive("@[`{@[`{@[`{@[`{@[`{", "`{@[`{@[`{@[`{@[`{@[", 20));
+    }
+}
@@ -10,6 +10,8 @@
 #include <Core/Vector.hpp>
 #include <Core/FlatVector.hpp>
 #include <Core/SmallVector.hpp>
+#include <Core/FlatString.hpp>
+#include <Core/Functor.hpp>
 
 #define PassVargs(...) __VA_OPT__(,) __VA_ARGS__
 
@@ -147,6 +149,30 @@ TEST(Vector, Reserve) \
     ASSERT_EQ(vector.capacity(), count); \
 } \
  \
+TEST(Vector, ShrinkToFit) \
+{ \
+    constexpr auto str = "Vector is an amazing 8 bytes vector !"; \
+    constexpr auto count = 10ul; \
+ \
+    Vector<std::string PassVargs(__VA_ARGS__)> vector; \
+ \
+    ASSERT_FALSE(vector.shrinkToFit()); \
+    vector.reserve(count * 4); \
+    vector.resize(count, str); \
+    ASSERT_TRUE(vector.shrinkToFit()); \
+    ASSERT_EQ(vector.size(), count); \
+    ASSERT_EQ(vector.capacity(), count); \
+    ASSERT_FALSE(vector.shrinkToFit()); \
+    for (auto &elem : vector) \
+        ASSERT_EQ(elem, str); \
+    vector.clear(); \
+    ASSERT_TRUE(vector.shrinkToFit()); \
+    ASSERT_EQ(vector.capacity(), 0); \
+    ASSERT_EQ(vector.data(), nullptr); \
+    vector.push(str); \
+    ASSERT_EQ(vector[0], str); \
+} \
+ \
 TEST(Vector, Move) \
 { \
     Vector<std::size_t PassVargs(__VA_ARGS__)> vector; \
@@ -226,6 +252,30 @@ TEST(Vector, InsertFill) \
         ASSERT_EQ(vector[i], 32); \
 } \
  \
+TEST(Vector, InsertNonTrivial) \
+{ \
+    const std::string value("Long enough string to be heap allocated"); \
+    Vector<std::string PassVargs(__VA_ARGS__)> vector; \
+ \
+    for (auto i = 0; i < 8; ++i) \
+        vector.push(std::to_string(i)); \
+    vector.insertCopy(vector.begin() + 4, 2, value); \
+    vector.insertCopy(vector.begin() + 1, 20, value); \
+    ASSERT_EQ(vector.size(), 30); \
+    ASSERT_EQ(vector[0], "0"); \
+    for (auto i = 1u; i < 21u; ++i) \
+        ASSERT_EQ(vector[i], value); \
+    ASSERT_EQ(vector[21], "1"); \
+    ASSERT_EQ(vector[24], value); \
+    ASSERT_EQ(vector[26], "4"); \
+    ASSERT_EQ(vector.back(), "7"); \
+    vector.insertCopy(vector.begin() + 28, 3, value); \
+    ASSERT_EQ(vector.size(), 33); \
+    ASSERT_EQ(vector[28], value); \
+    ASSERT_EQ(vector[31], "6"); \
+    ASSERT_EQ(vector.back(), "7"); \
+} \
+ \
 TEST(Vector, Clear) \
 { \
     constexpr auto count = 42; \
@@ -241,7 +291,10 @@ TEST(Vector, Clear) \
             ASSERT_EQ(data[i], value2); \
     vector.clear(); \
     vector.insertCopy(vector.begin(), count * 2, value1); \
-    ASSERT_NE(vector.data(), data); \
+    /* The buffer may grow in place, so only its capacity is checked */ \
+    ASSERT_GE(vector.capacity(), count * 2); \
+    for (auto i = 0u; i < count * 2; ++i) \
+        ASSERT_EQ(vector[i], value1); \
 } \
  \
 TEST(Vector, Erase) \
@@ -338,3 +391,165 @@ TEST(SmallVector, SmallOptimizationPush)
 
     PushTest(vector, 4, false);
 }
+
+TEST(SmallVector, SmallOptimizationShrinkToFit)
+{
+    SmallVector<std::unique_ptr<int>, 4> vector;
+
+    for (auto i = 0; i < 8; ++i)
+        vector.push(std::make_unique<int>(i));
+    ASSERT_FALSE(vector.isCacheUsed());
+    vector.erase(vector.begin() + 3, vector.end());
+    ASSERT_TRUE(vector.shrinkToFit());
+    ASSERT_TRUE(vector.isCacheUsed());
+    ASSERT_EQ(vector.capacity(), 3);
+    for (auto i = 0; i < 3; ++i)
+        ASSERT_EQ(*vector.at(i), i);
+}
+
+TEST(Vector, GrowthPolicy)
+{
+    const auto capacities = [](auto &&vector, const std::size_t count) {
+        std::vector<std::size_t> result;
+        for (auto i = 0ul; i < count; ++i) {
+            vector.push(i);
+            if (result.empty() || result.back() != vector.capacity())
+                result.push_back(vector.capacity());
+        }
+        for (auto i = 0ul; i < count; ++i)
+            EXPECT_EQ(vector[i], i);
+        return result;
+    };
+
+    ASSERT_EQ(capacities(Vector<std::size_t>(), 20), std::vector<std::size_t>({ 2, 4, 8, 16, 32 }));
+    ASSERT_EQ(capacities(Vector<std::size_t, std::size_t, HalfGrowthPolicy>(), 20), std::vector<std::size_t>({ 2, 3, 4, 6, 9, 13, 19, 28 }));
+    ASSERT_EQ(capacities(TinyVector<std::size_t, StepGrowthPolicy<8>>(), 20), std::vector<std::size_t>({ 2, 10, 18, 26 }));
+    ASSERT_EQ(capacities(FlatVector<std::size_t, std::size_t, Internal::NoCustomHeaderType, StepGrowthPolicy<8>>(), 20), std::vector<std::size_t>({ 2, 10, 18, 26 }));
+    ASSERT_EQ(capacities(SmallVector<std::size_t, 4, std::size_t, StepGrowthPolicy<8>>(), 20), std::vector<std::size_t>({ 2, 10, 18, 26 }));
+    // Page growth doubles small buffers, then allocates whole pages
+    const auto pages = capacities(Vector<std::size_t, std::size_t, PageGrowthPolicy<4096>>(), 4096);
+    ASSERT_EQ(pages[7], 256);
+    for (auto i = 9ul; i < pages.size(); ++i) {
+        ASSERT_EQ(pages[i] * sizeof(std::size_t) % 4096, 0);
+        ASSERT_LE(pages[i], pages[i - 1] * 3 / 2 + 4096 / sizeof(std::size_t));
+    }
+    static_assert(PageGrowthPolicy<4096>::NextCapacity<char, std::size_t>(4096, 0) == 8192);
+    static_assert(PageGrowthPolicy<4096>::NextCapacity<char, std::size_t>(4096, 10000) == 16384);
+}
+
+namespace
+{
+    /** @brief Counts its move constructions and destructions */
+    struct RelocationCounter
+    {
+        static inline std::size_t MoveCount = 0;
+        static inline std::size_t DestructCount = 0;
+
+        RelocationCounter(const std::size_t value_) noexcept : value(value_) {}
+        RelocationCounter(RelocationCounter &&other) noexcept : value(other.value) { ++MoveCount; }
+        ~RelocationCounter(void) noexcept { ++DestructCount; }
+
+        RelocationCounter &operator=(RelocationCounter &&other) noexcept { value = other.value; return *this; }
+
+        std::size_t value;
+    };
+}
+
+template<>
+struct Core::IsTriviallyRelocatable<RelocationCounter>
+{
+    static constexpr bool Value = true;
+};
+
+TEST(Vector, TriviallyRelocatable)
+{
+    static_assert(IsTriviallyRelocatable<int>::Value);
+    static_assert(!IsTriviallyRelocatable<std::string>::Value);
+    static_assert(IsTriviallyRelocatable<Vector<std::string>>::Value);
+    static_assert(IsTriviallyRelocatable<FlatVector<std::string>>::Value);
+    static_assert(!IsTriviallyRelocatable<SmallVector<std::string, 4>>::Value);
+    static_assert(IsTriviallyRelocatable<FlatString>::Value);
+    static_assert(IsTriviallyRelocatable<Functor<void(void)>>::Value);
+
+    Vector<RelocationCounter> vector;
+    for (auto i = 0ul; i < 100; ++i)
+        vector.push(i);
+    vector.insert(vector.begin() + 10, RelocationCounter(1000));
+    vector.erase(vector.begin(), vector.begin() + 5);
+    vector.shrinkToFit();
+    // Only the inserted temporary is moved, relocations skip constructors and destructors
+    ASSERT_EQ(RelocationCounter::MoveCount, 1);
+    ASSERT_EQ(RelocationCounter::DestructCount, 1 + 5);
+    ASSERT_EQ(vector.size(), 96);
+    ASSERT_EQ(vector[5].value, 1000);
+    for (auto i = 0ul; i < 5; ++i)
+        ASSERT_EQ(vector[i].value, i + 5);
+    for (auto i = 6ul; i < vector.size(); ++i)
+        ASSERT_EQ(vector[i].value, i + 4);
+}
+
+TEST(Vector, RelocateNested)
+{
+    Vector<Vector<std::string>> vector;
+
+    for (auto i = 0ul; i < 100; ++i)
+        vector.push(Vector<std::string> { std::to_string(i), std::to_string(i * 2) });
+    vector.insert(vector.begin() + 50, Vector<std::string> { "inserted" });
+    vector.erase(vector.begin(), vector.begin() + 10);
+    ASSERT_EQ(vector.size(), 91);
+    ASSERT_EQ(vector[40][0], "inserted");
+    for (auto i = 0ul; i < 40; ++i) {
+        ASSERT_EQ(vector[i][0], std::to_string(i + 10));
+        ASSERT_EQ(vector[i][1], std::to_string((i + 10) * 2));
+    }
+    for (auto i = 41ul; i < vector.size(); ++i)
+        ASSERT_EQ(vector[i][0], std::to_string(i + 9));
+}
+
+TEST(Vector, Reallocate)
+{
+    // Large buffers are resized by the system, insertions keep shifting the tail
+    FlatVector<std::uint32_t> flat;
+    for (auto i = 0u; i < 100000u; ++i)
+        flat.push(i);
+    flat.insert(flat.begin() + 10, { 42u, 42u, 42u });
+    ASSERT_EQ(flat.size(), 100003);
+    for (auto i = 0u; i < 10u; ++i)
+        ASSERT_EQ(flat[i], i);
+    for (auto i = 10u; i < 13u; ++i)
+        ASSERT_EQ(flat[i], 42u);
+    for (auto i = 13u; i < flat.size(); ++i)
+        ASSERT_EQ(flat[i], i - 3);
+    flat.erase(flat.begin() + 1000, flat.end());
+    ASSERT_TRUE(flat.shrinkToFit());
+    ASSERT_EQ(flat.capacity(), 1000);
+    ASSERT_EQ(flat[999], 996u);
+
+    // A trivially relocatable custom header is reallocated along with the elements
+    using RelocatableHeader = std::pair<std::uint64_t, std::uint64_t>;
+    static_assert(IsTriviallyRelocatable<RelocatableHeader>::Value);
+    FlatVector<int, std::size_t, RelocatableHeader> relocatable;
+    relocatable.push(0);
+    relocatable.headerCustomType() = RelocatableHeader(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull);
+    for (auto i = 1; i < 100000; ++i)
+        relocatable.push(i);
+    relocatable.insert(relocatable.begin(), { -1, -2 });
+    ASSERT_EQ(relocatable.headerCustomType(), RelocatableHeader(0x0123456789ABCDEFull, 0xFEDCBA9876543210ull));
+    ASSERT_EQ(relocatable.size(), 100002);
+    ASSERT_EQ(relocatable[1], -2);
+    for (auto i = 2ul; i < relocatable.size(); ++i)
+        ASSERT_EQ(relocatable[i], static_cast<int>(i - 2));
+
+    // Other custom headers are moved to a new buffer
+    static_assert(!IsTriviallyRelocatable<std::string>::Value);
+    FlatVector<int, std::size_t, std::string> custom;
+    custom.push(0);
+    custom.headerCustomType() = "a header string long enough to be heap allocated";
+    for (auto i = 1; i < 1000; ++i)
+        custom.push(i);
+    ASSERT_EQ(custom.headerCustomType(), "a header string long enough to be heap allocated");
+    ASSERT_EQ(custom[999], 999);
+
+    // Over-aligned buffers can't be reallocated
+    ASSERT_EQ(Utils::AlignedRealloc(nullptr, 64, 2 * alignof(std::max_align_t)), nullptr);
+}
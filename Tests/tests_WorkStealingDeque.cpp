@@ -0,0 +1,79 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the work-stealing deque
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Core/Assert.hpp>
+#include <Core/WorkStealingDeque.hpp>
+
+TEST(WorkStealingDeque, PushPopSteal)
+{
+    constexpr std::size_t queueSize = 8;
+
+    Core::WorkStealingDeque<std::size_t> deque(queueSize);
+    std::size_t value = 0;
+
+    ASSERT_FALSE(deque.pop(value));
+    ASSERT_FALSE(deque.steal(value));
+    for (auto i = 0ul; i < queueSize; ++i)
+        ASSERT_TRUE(deque.push(i));
+    ASSERT_FALSE(deque.push(42ul));
+    ASSERT_EQ(deque.size(), queueSize);
+    ASSERT_TRUE(deque.pop(value));
+    ASSERT_EQ(value, queueSize - 1);
+    ASSERT_TRUE(deque.steal(value));
+    ASSERT_EQ(value, 0);
+    ASSERT_TRUE(deque.steal(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_TRUE(deque.pop(value));
+    ASSERT_EQ(value, queueSize - 2);
+    ASSERT_EQ(deque.size(), queueSize - 4);
+}
+
+TEST(WorkStealingDeque, IntensiveStealing)
+{
+    constexpr auto ThiefCount = 3;
+    constexpr std::size_t Counter = CORE_DEBUG_BUILD ? 4096 : 1 << 18;
+    constexpr std::size_t queueSize = 256;
+
+    Core::WorkStealingDeque<std::size_t> deque(queueSize);
+    std::atomic<bool> running { true };
+    std::atomic<std::size_t> sum { 0 };
+    std::atomic<std::size_t> count { 0 };
+    std::thread thieves[ThiefCount];
+
+    for (auto &thief : thieves) {
+        thief = std::thread([&] {
+            std::size_t value;
+            while (running) {
+                if (deque.steal(value)) {
+                    sum += value;
+                    ++count;
+                }
+            }
+        });
+    }
+    std::size_t value;
+    for (auto i = 1ul; i <= Counter;) {
+        if (deque.push(i))
+            ++i;
+        else if (deque.pop(value)) {
+            sum += value;
+            ++count;
+        }
+    }
+    while (deque.pop(value)) {
+        sum += value;
+        ++count;
+    }
+    while (count != Counter)
+        std::this_thread::yield();
+    running = false;
+    for (auto &thief : thieves)
+        thief.join();
+    ASSERT_EQ(sum, Counter * (Counter + 1) / 2);
+}